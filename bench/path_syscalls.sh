@@ -0,0 +1,85 @@
+#!/bin/sh
+# Self-test of command resolution: counts the filesystem calls (access,
+# stat, fstatat, open...) the shell really makes, through the LD_PRELOAD
+# interposer in bench/syscount.c, and compares them with the shell as it
+# was before candidates were classified from a single stat.
+#
+# `true` is resolved behind DIRS directories: empty ones, then ones holding
+# a `true` that cannot run (a non-executable file or a directory). A script
+# doing `hash -r` and `hash true` N times is compared with one doing
+# `hash -r` and `:`, so that only the lookups make the difference. Both
+# builtins run in the shell, no process is started. A non-executable file
+# used to cost two calls (faccessat, then fstatat); the current shell must
+# cost no more than one call per candidate, never more than before, and
+# less on non-executable files.
+#
+# usage: bench/path_syscalls.sh [dirs] [minishell binary] [baseline binary]
+# Without a baseline binary, one is built from BASE_REV (by default the
+# commit before "Classify each command candidate from a single stat").
+
+DIRS="${1:-15}"
+MS="${2:-./minishell}"
+BASE_MS="$3"
+N=100
+TMP="$(mktemp -d)"
+trap 'rm -rf "$TMP"; [ -d "$TMP.wt" ] && git worktree remove --force "$TMP.wt"' EXIT
+
+cc -shared -fPIC -o "$TMP/syscount.so" bench/syscount.c -ldl || exit 1
+
+if [ -z "$BASE_MS" ]; then
+	REV="${BASE_REV:-$(git log --format=%H -F \
+		--grep='Classify each command candidate from a single stat' | tail -n 1)^}"
+	git worktree add -q --detach "$TMP.wt" "$REV" || exit 1
+	make -C "$TMP.wt" CFLAGS="-Wall -Wextra -MD -MP" > /dev/null 2>&1 \
+		|| { echo "cannot build $REV"; exit 1; }
+	BASE_MS="$TMP.wt/minishell"
+fi
+
+BIN_DIR=""
+for d in $(echo "$PATH" | tr ':' ' '); do
+	[ -z "$BIN_DIR" ] && [ -x "$d/true" ] && BIN_DIR="$d"
+done
+
+i=0
+while [ "$i" -lt "$N" ]; do
+	printf 'hash -r\nhash true\n' >> "$TMP/lookups"
+	printf 'hash -r\n:\n' >> "$TMP/idle"
+	i=$((i + 1))
+done
+
+# Calls made by shell "$2" for one script "$3", PATH in "$1"
+count() {
+	env -i PATH="$1" LD_PRELOAD="$TMP/syscount.so" "$2" "$3" \
+		2>&1 > /dev/null | awk '/^syscount:/ { n = $2 } END { print n }'
+}
+
+# Calls per lookup of shell "$2" over DIRS directories of kind "$1" (empty,
+# file or dir) in front of the one holding `true`
+measure() {
+	P=""
+	i=0
+	while [ "$i" -lt "$DIRS" ]; do
+		mkdir -p "$TMP/$1$i"
+		[ "$1" = "file" ] && [ ! -e "$TMP/$1$i/true" ] && : > "$TMP/$1$i/true"
+		[ "$1" = "dir" ] && mkdir -p "$TMP/$1$i/true"
+		P="$P$TMP/$1$i:"
+		i=$((i + 1))
+	done
+	LOOKUPS=$(count "$P$BIN_DIR" "$2" "$TMP/lookups")
+	IDLE=$(count "$P$BIN_DIR" "$2" "$TMP/idle")
+	[ -n "$LOOKUPS" ] && [ -n "$IDLE" ] && [ "$LOOKUPS" -gt "$IDLE" ] \
+		|| return 1
+	echo $(((LOOKUPS - IDLE) / N))
+}
+
+FAIL=0
+echo "$((DIRS + 1)) candidates, calls per lookup (baseline -> current):"
+for kind in empty file dir; do
+	OLD=$(measure "$kind" "$BASE_MS") || { echo "no count"; exit 1; }
+	NEW=$(measure "$kind" "$MS") || { echo "no count"; exit 1; }
+	echo "  $kind: $OLD -> $NEW"
+	[ "$NEW" -le "$OLD" ] && [ "$NEW" -le "$((DIRS + 1))" ] || FAIL=1
+	[ "$kind" != "file" ] || [ "$NEW" -lt "$OLD" ] || FAIL=1
+done
+[ "$FAIL" -eq 0 ] || { echo "FAIL"; exit 1; }
+echo "OK"
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Compares the launch rate of external commands through posix_spawn() (the
+# default) and through fork() (MINISHELL_NO_SPAWN set).
+#
+# usage: bench/spawn_bench.sh [commands] [minishell binary]
+
+N="${1:-2000}"
+MS="${2:-./minishell}"
+SCRIPT="$(mktemp)"
+trap 'rm -f "$SCRIPT"' EXIT
+
+i=0
+while [ "$i" -lt "$N" ]; do
+	echo "true" >> "$SCRIPT"
+	i=$((i + 1))
+done
+
+run() {
+	start=$(date +%s%N)
+	env "$@" "$MS" "$SCRIPT" || exit 1
+	end=$(date +%s%N)
+	ms=$(((end - start) / 1000000))
+	[ "$ms" -gt 0 ] || ms=1
+	echo "$((N * 1000 / ms)) commands/s ($N commands in ${ms} ms)"
+}
+
+printf "%-8s" "spawn:"
+run -u MINISHELL_NO_SPAWN
+printf "%-8s" "fork:"
+run MINISHELL_NO_SPAWN=1
@@ -0,0 +1,97 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   syscount.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:08:55 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:08:55 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+/*
+** LD_PRELOAD interposer counting the filesystem calls a process makes to
+** look names up: access, faccessat, stat, lstat, fstat, fstatat, open and
+** openat. The total is printed on stderr when the process exits. Built and
+** used by bench/path_syscalls.sh.
+*/
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static unsigned long	g_calls;
+
+static void	*real(const char *name)
+{
+	g_calls++;
+	return (dlsym(RTLD_NEXT, name));
+}
+
+int	access(const char *path, int mode)
+{
+	return (((int (*)(const char *, int))real("access"))(path, mode));
+}
+
+int	faccessat(int fd, const char *path, int mode, int flags)
+{
+	return (((int (*)(int, const char *, int, int))real("faccessat"))
+		(fd, path, mode, flags));
+}
+
+int	stat(const char *path, struct stat *st)
+{
+	return (((int (*)(const char *, struct stat *))real("stat"))(path, st));
+}
+
+int	lstat(const char *path, struct stat *st)
+{
+	return (((int (*)(const char *, struct stat *))real("lstat"))(path, st));
+}
+
+int	fstat(int fd, struct stat *st)
+{
+	return (((int (*)(int, struct stat *))real("fstat"))(fd, st));
+}
+
+int	fstatat(int fd, const char *path, struct stat *st, int flags)
+{
+	return (((int (*)(int, const char *, struct stat *, int))real("fstatat"))
+		(fd, path, st, flags));
+}
+
+int	open(const char *path, int flags, ...)
+{
+	va_list	ap;
+	mode_t	mode;
+
+	va_start(ap, flags);
+	mode = va_arg(ap, mode_t);
+	va_end(ap);
+	return (((int (*)(const char *, int, mode_t))real("open"))
+		(path, flags, mode));
+}
+
+int	openat(int fd, const char *path, int flags, ...)
+{
+	va_list	ap;
+	mode_t	mode;
+
+	va_start(ap, flags);
+	mode = va_arg(ap, mode_t);
+	va_end(ap);
+	return (((int (*)(int, const char *, int, mode_t))real("openat"))
+		(fd, path, flags, mode));
+}
+
+__attribute__((destructor))
+static void	syscount_report(void)
+{
+	dprintf(STDERR_FILENO, "syscount: %lu\n", g_calls);
+}
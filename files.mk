@@ -7,8 +7,13 @@ SRC_F				= \
 						builtins/builtin_export \
 						builtins/builtin_export_utils \
 						builtins/builtin_export_utils2 \
+						builtins/builtin_hash \
+						builtins/builtin_jobs \
 						builtins/builtin_pwd \
+						builtins/builtin_registry \
+						builtins/builtin_set \
 						builtins/builtin_unset \
+						builtins/builtin_wait \
 						checker/token_checker \
 						checker/token_checker_utils \
 						command/command_add \
@@ -16,28 +21,36 @@ SRC_F				= \
 						command/command_parse \
 						command/command_parse_utils \
 						command/command_parse_utils2 \
-						env/env \
+						env/env_expand \
 						env/env_find \
 						env/env_find_bin \
 						env/env_quotes \
-						env/env_quotes_utils \
-						env/env_utils \
+						env/env_store \
+						env/env_store_envp \
+						env/env_store_table \
+						env/env_store_utils \
 						error/ctx_error_exit \
 						error/error \
 						error/error_utils \
 						error/error_utils2 \
+						execution/execute_background \
 						execution/execute_builtin \
 						execution/execute_commands \
+						execution/execute_lastpipe \
+						execution/execute_list \
 						execution/execute_pipeline \
 						execution/execute_pipeline_child \
 						execution/execute_pipeline_utils \
+						execution/execute_spawn \
+						execution/execute_spawn_utils \
+						execution/execute_wait \
 						execution/heredoc \
-						execution/heredoc_expand \
-						execution/heredoc_expand_utils \
+						execution/heredoc_file \
+						execution/heredoc_prefetch \
 						execution/heredoc_process \
 						execution/heredoc_signals \
-						execution/heredoc_utils \
 						execution/heredoc_utils2 \
+						execution/pipestatus \
 						execution/redir_cleanup \
 						execution/redirection \
 						execution/redirection_input \
@@ -49,21 +62,41 @@ SRC_F				= \
 						globals/globals \
 						init/init_ctx \
 						init/init_parse \
+						input/input_process \
+						input/input_reader \
+						input/input_reader_utils \
+						input/input_script \
+						jobs/job_reap \
+						jobs/job_reaper \
+						jobs/job_sigchld \
+						jobs/job_table \
+						lexer/lexer_class \
 						lexer/lexer_read \
 						lexer/lexer_read_utils \
 						lexer/lexer_read_utils2 \
+						lexer/lexer_scan \
 						lexer/lexer_token \
 						lexer/lexer_token_is \
 						lexer/lexer_token_utils \
 						lexer/lexer_tokenize \
 						lexer/lexer_utils \
+						memory/arena \
+						memory/arena_utils \
 						memory/cleanup_utils \
 						memory/memory \
+						path/bin_cache \
+						path/bin_cache_epoch \
+						path/bin_cache_utils \
 						path/bin_find \
 						path/bin_find_path \
 						path/bin_find_utils \
 						path/path_error \
+						path/path_exec \
+						path/path_vec \
+						path/path_watch \
 						signals/signals \
+						trace/trace \
+						trace/trace_flush \
 						validation/validation \
 						main
 TSRC_F			=		$(subst main,test/main,$(SRC_F))
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 09:51:56 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:49:31 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,16 @@
 
 # include "minishell.h"
 
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+/* Slots of the registry index, to keep well above the number of builtins */
+# define BUILTIN_SLOTS 32
+
+/* Changes the shell's state: has no lasting effect outside the shell */
+# define BUILTIN_PARENT 1
+
 // *************************************************************************** #
 //                            Function Prototypes                              #
 // *************************************************************************** #
@@ -26,8 +36,8 @@ int		builtin_cd(t_ctx *ctx, t_command *cmd);
 // builtin_cd_utils.c
 char	*get_old_pwd(t_ctx *ctx);
 char	*get_home_dir(t_ctx *ctx);
-t_env	*update_pwd_variable(t_env *env_node, char *new_pwd);
-void	update_oldpwd_variable(t_env *old_pwd_node, char *old_pwd);
+void	update_pwd_variable(t_env_store *env, char *new_pwd);
+void	update_oldpwd_variable(t_env_store *env, char *old_pwd);
 char	*handle_dot_directory(void);
 
 // builtin_echo.c
@@ -48,7 +58,7 @@ int		builtin_export(t_ctx *ctx, t_command *cmd);
 bool	is_valid_env_char(char c);
 char	*get_env_key_from_export(char *arg);
 void	print_export_env(t_ctx *ctx);
-bool	update_env_var(t_env **env_list, char *key, char *value,
+bool	update_env_var(t_env_store *env, char *key, char *value,
 			bool has_equals);
 
 // builtin_export_utils2.c
@@ -57,11 +67,26 @@ int		extract_export_data(char *arg, char **key_ptr, char **value_ptr,
 int		update_or_add_env_var(t_ctx *ctx, char *key, char *value,
 			bool has_equals);
 
+// builtin_hash.c
+int		builtin_hash(t_ctx *ctx, t_command *cmd);
+
+// builtin_jobs.c
+int		builtin_jobs(t_ctx *ctx, t_command *cmd);
+
 // builtin_pwd.c
-int		builtin_pwd(void);
+int		builtin_pwd(t_ctx *ctx, t_command *cmd);
+
+// builtin_registry.c
+const t_builtin	*builtin_lookup(const char *name);
+
+// builtin_set.c
+int		builtin_set(t_ctx *ctx, t_command *cmd);
 
 // builtin_unset.c
-bool	remove_env_var(t_env **env_list, char *key);
+bool	remove_env_var(t_env_store *env, char *key);
 int		builtin_unset(t_ctx *ctx, t_command *cmd);
 
+// builtin_wait.c
+int		builtin_wait(t_ctx *ctx, t_command *cmd);
+
 #endif
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 13:39:37 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:02:18 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:03:00 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,23 +15,34 @@
 
 # include "minishell.h"
 
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define ARGS_MIN 8
+
 // *************************************************************************** #
 //                            Function Prototypes                              #
 // *************************************************************************** #
 
 // command_add.c
-int			command_add_redirection(t_command *cmd, t_token_type type,
-				char *filename);
+int			command_add_redirection(t_arena *arena, t_command *cmd,
+				t_token *op, char *filename);
+void		command_terminate_args(t_command *cmd);
 
 // command_new.c
-t_command	*command_new(void);
+t_command	*command_new(t_arena *arena);
 
 // command_parse.c
 t_command	*command_parse(t_ctx *ctx, t_token *tokens);
 
 // command_parse_utils.c
-bool		handle_first_arg(t_command *cmd, char *expanded_value);
-bool		add_to_existing_args(t_command *cmd, char *expanded_value);
+bool		handle_first_arg(t_arena *arena, t_command *cmd,
+				char *expanded_value);
+bool		add_to_existing_args(t_arena *arena, t_command *cmd,
+				char *expanded_value);
+bool		add_expanded_arg(t_arena *arena, t_command *cmd,
+				char *expanded_value);
 bool		process_word_token(t_command *cmd, t_token *token, t_ctx *ctx);
 bool		process_word_token_case(t_command *cmd, t_token **current,
 				t_ctx *ctx, bool *first_arg_processed);
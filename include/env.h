@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 13:47:31 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:39:41 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:34:05 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,20 +16,14 @@
 # include "minishell.h"
 
 // *************************************************************************** #
-//                            Function Prototypes                              #
+//                                   Macros                                    #
 // *************************************************************************** #
 
-// env.c
-char	*expand_var(t_ctx *ctx, char *var_name);
-char	*append_part(char *result, char *str, int start, int end);
-char	*get_env_value(t_env *env_list, char *key);
-char	*get_var_name(char *str, int *pos);
-char	*expand_special_var(t_ctx *ctx, char *str, int *i);
+# define ENV_TABLE_MIN 64
 
-// env_utils.c
-char	*expand_positional_param(char *str, int *i);
-char	*expand_env_var(t_ctx *ctx, char *str, int *i);
-char	*expand_variable(t_ctx *ctx, char *str, int *i);
+// *************************************************************************** #
+//                            Function Prototypes                              #
+// *************************************************************************** #
 
 // env_dupe.c
 t_env	*duplicate_env_list(t_env *original_list);
@@ -40,12 +34,29 @@ char	*env_find(t_ctx *ctx, char *var);
 // env_find_bin.c
 char	*env_find_bin(t_ctx *ctx, char *bin);
 
+// env_store.c
+unsigned int	env_hash(const char *key, size_t len);
+void	env_store_init(t_env_store *store);
+int		add_env_var(t_env_store *store, char *key, char *value);
+char	*get_env_value(t_env_store *store, char *key);
+
+// env_store_table.c
+t_env	*env_lookup(t_env_store *store, const char *key, size_t len);
+bool	env_table_insert(t_env_store *store, t_env *node);
+void	env_table_delete(t_env_store *store, t_env *node);
+
+// env_store_utils.c
+void	env_list_unlink(t_env_store *store, t_env *node);
+void	env_assign(t_env_store *store, t_env *node, char *value);
+int		env_set(t_env_store *store, char *key, char *value);
+
+// env_store_envp.c
+char	**env_store_envp(t_env_store *store);
+
+// env_expand.c
+bool	expand_word(t_ctx *ctx, const char *str, t_strbuf *sb);
+
 // env_quotes.c
 char	*handle_quotes_and_vars(t_ctx *ctx, t_token *token);
-char	*append_text_part(int start, int i, char *result, char *str);
-char	*handle_var_expansion(t_ctx *ctx, char *str, int *i, char *result);
-
-// env_quotes_utils.c
-char	*process_string(t_ctx *ctx, char *str, char *result);
 
 #endif
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/17 15:32:19 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:37:34 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:20:25 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,6 +22,7 @@
 typedef enum e_error_type
 {
 	ERR_CMD_NOT_FOUND,
+	ERR_NOT_FOUND,
 	// Fs
 	ERR_NO_PERMS,
 	ERR_NO_FILE,
@@ -52,6 +53,10 @@ typedef enum e_error_type
 	ERR_IDENTIFIER,
 	ERR_NUMERIC,
 	ERR_TOO_MANY_ARGS,
+	ERR_INVALID_OPTION,
+	ERR_OPTION_ARG,
+	ERR_NO_JOB,
+	ERR_READONLY,
 }				t_error_type;
 
 typedef struct s_error_info
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/02 16:43:21 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:39:10 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:07:29 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,6 +14,14 @@
 # define EXECUTE_H
 
 # include "minishell.h"
+# include <spawn.h> // posix_spawn
+
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define HEREDOC_FLUSH 65536
+# define PIPESTATUS_MIN 4
 
 // *************************************************************************** #
 //                                 Structures                                  #
@@ -39,40 +47,63 @@ typedef struct s_pipeline
 // *************************************************************************** #
 
 // execute_commands.c
-void			execute_commands(t_ctx *ctx, t_command *cmd);
+bool			execute_commands(t_ctx *ctx, t_command *cmd);
+
+// execute_background.c
+bool			execute_background(t_ctx *ctx, t_token *tokens);
+
+// execute_list.c
+bool			execute_and_or(t_ctx *ctx, t_token *tokens);
+void			execute_list(t_ctx *ctx, t_token *tokens);
 
 // execute_builtin.c
-int				execute_builtin(t_ctx *ctx, t_command *cmd);
-bool			is_builtin_command(char *cmd_name);
+int				execute_builtin(t_ctx *ctx, t_command *cmd,
+					const t_builtin *builtin);
 
 // execute_pipeline.c
 void			execute_pipeline(t_ctx *ctx, t_command *cmd);
 
+// execute_lastpipe.c
+bool			execute_lastpipe(t_ctx *ctx, t_command *cmd,
+					t_pipeline *pipeline);
+
+// execute_spawn.c
+bool			spawn_command(t_ctx *ctx, t_command *cmd, int pipe_fds[2],
+					t_pipeline *pipeline);
+
+// execute_spawn_utils.c
+char			*spawn_path(t_ctx *ctx, t_command *cmd);
+bool			spawn_attr_init(posix_spawnattr_t *attr);
+
 // heredoc.c
+int				create_heredoc(t_ctx *ctx, char *delimiter);
 int				read_all_heredocs(t_ctx *ctx);
+int				discard_heredocs(t_ctx *ctx, t_token *tokens);
 
-// heredoc_expand.c
-char			*expand_variables_in_line(t_ctx *ctx, char *line);
+// heredoc_file.c
+int				heredoc_open(void);
+bool			heredoc_flush(int fd, t_strbuf *sb);
+bool			heredoc_rewind(int fd);
 
-// heredoc_expand_utils.c
-char			*init_expansion(char *line);
-char			*extract_var_name(char *str, int start, int end);
+// heredoc_prefetch.c
+int				prefetch_heredocs(t_ctx *ctx, t_token *tokens);
+void			close_prefetched_heredocs(t_token *tokens);
 
 // heredoc_process.c
-int				read_heredoc_content(int *pipe_fds, char *delimiter,
-					t_ctx *ctx);
+int				read_heredoc_content(int fd, char *delimiter, t_ctx *ctx);
 
 // heredoc_signals
 void			reset_heredoc_state(void);
 bool			is_heredoc_interrupted(void);
 int				interrupt_check_hook(void);
 
-// heredoc_utils.c
-char			*replace_substring(char *str, int start, int end,
-					char *replacement);
-
 // heredoc_utils2.c
-int				read_heredoc_line(char *delimiter, char **line);
+int				read_heredoc_line(t_ctx *ctx, char *delimiter, char **line);
+
+// pipestatus.c
+bool			pipestatus_reset(t_ctx *ctx, int count);
+void			pipestatus_single(t_ctx *ctx, int status);
+void			pipestatus_pipefail(t_ctx *ctx);
 
 // redir_cleanup.c
 void			cleanup_heredoc_resources(t_ctx *ctx);
@@ -92,12 +123,14 @@ bool			apply_output_redirection(t_command *cmd);
 int				count_commands(t_command *cmd);
 void			cleanup_pipes(int prev_pipe_read, int pipe_fds[2],
 					int has_next);
-void			wait_for_children(t_ctx *ctx, pid_t *pids, int cmd_count);
 bool			create_pipe(int pipe_fds[2]);
 void			execute_builtin_and_exit(t_ctx *ctx, t_command *cmd, int *pids);
 bool			setup_pipeline_step(t_command *current, int pipe_fds[2],
 					pid_t *pids);
 
+// execute_wait.c
+void			wait_for_children(t_ctx *ctx, pid_t *pids, int cmd_count);
+
 // execute_pipeline_child.c
 void			execute_command_in_child(t_ctx *ctx, t_command *cmd, t_fds fds,
 					int *pids);
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 13:49:00 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:04:32 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:13:26 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,8 +26,8 @@ void	free_2d_array(void **ptrs);
 void	ctx_clear(t_ctx *ctx);
 
 // free_env.c
-void	free_env_list(t_env *env_list);
-int		parse_env_var(char *env_str, t_env **env_list);
+void	free_env_list(t_env_store *store);
+int		parse_env_var(char *env_str, t_env_store *store);
 
 // free_command.c
 void	free_command(t_command *cmd);
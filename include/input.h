@@ -0,0 +1,47 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:15:14 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:00:50 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef INPUT_H
+# define INPUT_H
+
+# include "minishell.h"
+
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define READER_BUF_SIZE 65536
+
+// *************************************************************************** #
+//                            Function Prototypes                              #
+// *************************************************************************** #
+
+// input_process.c
+void	process_user_input(t_ctx *ctx, char *input);
+void	cleanup_resources(t_ctx *ctx);
+
+// input_reader.c
+bool	reader_init_fd(t_reader *reader, int fd);
+void	reader_init_str(t_reader *reader, char *str);
+char	*reader_next_line(t_reader *reader);
+void	reader_destroy(t_reader *reader);
+
+// input_reader_utils.c
+bool	reader_grow(t_reader *reader);
+void	reader_share(t_reader *reader);
+void	reader_sync(t_reader *reader);
+
+// input_script.c
+int		run_script(t_ctx *ctx, t_reader *reader);
+int		run_from_args(t_ctx *ctx, int argc, char **argv);
+
+#endif
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.h                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:50:04 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:33:21 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef JOBS_H
+# define JOBS_H
+
+# include "minishell.h"
+
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define JOB_RUNNING 0
+# define JOB_DONE 1
+
+// *************************************************************************** #
+//                                 Structures                                  #
+// *************************************************************************** #
+
+/**
+ * @brief Background jobs reaped by the SIGCHLD handler (see job_sigchld.c)
+ *
+ * A slot is free while its pid is 0; done is set once status holds the
+ * raw status of the exited job.
+ */
+typedef struct s_job_reaper
+{
+	volatile sig_atomic_t	pid[JOB_MAX];
+	volatile sig_atomic_t	status[JOB_MAX];
+	volatile sig_atomic_t	done[JOB_MAX];
+}							t_job_reaper;
+
+// *************************************************************************** #
+//                            Function Prototypes                              #
+// *************************************************************************** #
+
+// job_table.c
+int		job_add(t_ctx *ctx, pid_t pid, t_token *tokens);
+void	job_remove(t_ctx *ctx, int index);
+int		job_find(t_ctx *ctx, const char *spec);
+void	jobs_clear(t_ctx *ctx);
+
+// job_sigchld.c
+t_job_reaper	*job_reaper(void);
+void			job_reaper_scan(void);
+void			job_sigchld_init(void);
+
+// job_reaper.c
+void	job_reaper_add(pid_t pid);
+void	job_reaper_forget(pid_t pid);
+void	job_reaper_clear(void);
+
+// job_reap.c
+bool	jobs_record(t_ctx *ctx, pid_t pid, int wstatus);
+void	jobs_reap(t_ctx *ctx);
+int		job_wait(t_ctx *ctx, int index);
+void	job_print(t_outbuf *out, t_job *job);
+void	jobs_notify(t_ctx *ctx);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 13:50:50 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:02:06 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:44:40 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,27 @@
 
 # include "minishell.h"
 
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+/*
+** Character classes, see lex_class()
+*/
+# define LEX_WORD 0
+# define LEX_BLANK 1
+# define LEX_NEWLINE 2
+# define LEX_OPERATOR 4
+# define LEX_QUOTE 8
+# define LEX_DOLLAR 16
+# define LEX_END 32
+
+/*
+** Classes ending a word, and ending an unquoted run inside a word
+*/
+# define LEX_TOKEN_END 39
+# define LEX_WORD_END 47
+
 // *************************************************************************** #
 //                                 Structures                                  #
 // *************************************************************************** #
@@ -26,6 +47,8 @@ typedef struct s_lexer
 {
 	t_quote_state	quote;
 	bool			status;
+	t_arena			*arena;
+	t_strbuf		word;
 	char			*input;
 	int				position;
 	int				length;
@@ -48,31 +71,34 @@ typedef struct s_handle_token
 //                            Function Prototypes                              #
 // *************************************************************************** #
 
+// lexer_class.c
+unsigned char		lex_class(unsigned char c);
+bool				lex_is_word(unsigned char c);
+
 // lexer_read.c
-char				*read_word_lexer(t_lexer *lexer);
+bool				read_word_lexer(t_lexer *lexer);
 char				*read_complex_word(t_lexer *lexer);
-char				*read_quoted_string_lexer(t_lexer *lexer, char quote_char);
+bool				read_quoted_string_lexer(t_lexer *lexer, char quote_char);
 
 // lexer_read_utils.c
-char				*join_and_free(char *s1, char *s2);
 char				*handle_dollar_sign(char *result);
-char				*handle_word_part(t_lexer *lexer, char *result);
-char				*handle_quoted_part(t_lexer *lexer, char *result,
-						char quote_char);
 char				*handle_dollar_quotes(t_lexer *lexer);
 
 // lexer_read_utils2.c
 void				set_quote_flags(t_lexer *lexer, char quote_char);
-char				*create_quoted_content(t_lexer *lexer, int start, int end);
-char				*handle_word_part_by_type(t_lexer *lexer, char *result,
-						char quote_char);
+bool				handle_word_part_by_type(t_lexer *lexer, char quote_char);
+
+// lexer_scan.c
+size_t				lex_word_run(const char *s, size_t len);
 
 // lexer_token.c
 t_token				*next_token_lexer(t_lexer *lexer);
-void				free_all_token(t_token *token);
 
 // lexer_token_is.c
 bool				token_is_redirection(t_token_type type);
+bool				token_is_list_operator(t_token_type type);
+bool				token_is_separator(t_token_type type);
+bool				token_is_missing_operand(t_token_type type);
 
 // lexer_token_utils.c
 t_token				*handle_basics_token(t_lexer *lexer);
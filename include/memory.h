@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/17 15:33:40 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 13:51:27 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 09:39:29 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,13 @@
 
 # include "minishell.h"
 
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define ARENA_CHUNK_SIZE 16384
+# define ARENA_ALIGN 16
+
 // *************************************************************************** #
 //                            Function Prototypes                              #
 // *************************************************************************** #
@@ -26,6 +33,17 @@ char	*safe_strjoin(t_ctx *ctx, const char *s1, const char *s2,
 void	*safe_malloc(t_ctx *ctx, size_t size, const char *module);
 void	*safe_calloc(t_ctx *ctx, size_t nmemb, size_t size, const char *module);
 
+// arena.c
+void	*arena_alloc(t_arena *arena, size_t size);
+void	arena_reset(t_arena *arena);
+void	arena_destroy(t_arena *arena);
+
+// arena_utils.c
+void	arena_init(t_arena *arena);
+char	*arena_strndup(t_arena *arena, const char *str, size_t len);
+char	*arena_strdup(t_arena *arena, const char *str);
+void	arena_print_stats(t_ctx *ctx);
+
 // cleanup_utils.c
 void	safe_free_str(char **str);
 
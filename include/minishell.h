@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/04 17:15:54 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 15:34:57 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:12:09 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -38,6 +38,8 @@
 # define YELLOW "\033[093m"
 # define CYAN "\033[36m"
 
+# define JOB_MAX 64
+
 // *************************************************************************** #
 //                                 Structures                                  #
 // *************************************************************************** #
@@ -87,6 +89,7 @@ typedef struct s_token
 	t_quote_state		quote;
 	struct s_token		*next;
 	char				*value;
+	int					fd;
 }						t_token;
 
 /**
@@ -99,28 +102,208 @@ typedef struct s_command
 	struct s_command	*next;
 	char				**args;
 	int					arg_count;
+	int					arg_cap;
 }						t_command;
 
+/**
+ * @brief Environment variable, with its name length and hash precomputed
+ */
 typedef struct s_env
 {
 	struct s_env		*next;
+	struct s_env		*prev;
 	char				*key;
 	char				*value;
+	size_t				key_len;
+	unsigned int		hash;
 }						t_env;
 
+/**
+ * @brief Environment variables, kept in insertion order in a linked list
+ * and indexed by an open-addressing (linear probing) hash table
+ *
+ * `gen` is bumped on every change; `envp` is the exported environment as
+ * built for `execve`, valid while `envp_gen` equals `gen`.
+ */
+typedef struct s_env_store
+{
+	t_env				*head;
+	t_env				*tail;
+	t_env				**slots;
+	size_t				cap;
+	size_t				count;
+	unsigned long		gen;
+	char				**envp;
+	unsigned long		envp_gen;
+}						t_env_store;
+
+/**
+ * @brief Hashed command: resolved full path and number of uses
+ *
+ * An entry without a path remembers that the command was not found; it
+ * holds while the PATH directories keep the epoch it was recorded in.
+ */
+typedef struct s_bin_entry
+{
+	char				*name;
+	char				*path;
+	unsigned int		hash;
+	unsigned int		hits;
+	unsigned long		epoch;
+}						t_bin_entry;
+
+/**
+ * @brief Effective credentials of the shell, to tell whether it may
+ * execute a file from a single stat()
+ */
+typedef struct s_creds
+{
+	uid_t				uid;
+	gid_t				gid;
+	gid_t				*groups;
+	int					ngroups;
+}						t_creds;
+
+/**
+ * @brief One directory of PATH, with a descriptor to probe names in it
+ */
+typedef struct s_path_dir
+{
+	char				*dir;
+	size_t				len;
+	int					fd;
+	int					wd;
+	struct timespec		mtime;
+}						t_path_dir;
+
+/**
+ * @brief PATH split once into its directories, rebuilt when PATH changes
+ *
+ * watch_fd is the optional inotify instance watching the directories (see
+ * path_watch.c), -1 when off.
+ */
+typedef struct s_path_vec
+{
+	t_path_dir			*dirs;
+	size_t				count;
+	bool				valid;
+	bool				saw_file;
+	size_t				hit;
+	unsigned long		epoch;
+	int					watch_fd;
+}						t_path_vec;
+
+/**
+ * @brief Command path cache (`hash`), an open-addressing hash table
+ */
+typedef struct s_bin_cache
+{
+	t_bin_entry			**slots;
+	size_t				cap;
+	size_t				count;
+}						t_bin_cache;
+
+/**
+ * @brief Buffered line reader used for non-interactive input
+ */
+typedef struct s_reader
+{
+	int					fd;
+	char				*buf;
+	size_t				len;
+	size_t				pos;
+	size_t				cap;
+	bool				eof;
+	bool				owned;
+	bool				seekable;
+	bool				bytewise;
+}						t_reader;
+
+/**
+ * @brief Block of memory carved by the arena allocator
+ */
+typedef struct s_arena_chunk
+{
+	struct s_arena_chunk	*next;
+	size_t					size;
+	size_t					used;
+	char					*data;
+}							t_arena_chunk;
+
+/**
+ * @brief Bump allocator owning everything allocated for one input line
+ */
+typedef struct s_arena
+{
+	t_arena_chunk		*head;
+	t_arena_chunk		*current;
+	size_t				allocs;
+	size_t				mallocs;
+}						t_arena;
+
 typedef struct s_fds
 {
 	int					in;
 	int					out;
 }						t_fds;
 
+/**
+ * @brief One recorded trace event (see src/trace)
+ */
+typedef struct s_trace_event
+{
+	const char			*name;
+	unsigned long		ts;
+	int					pid;
+	char				phase;
+}						t_trace_event;
+
+/**
+ * @brief Trace recorder: a preallocated ring of events and the output file
+ */
+typedef struct s_trace
+{
+	t_trace_event		*ring;
+	size_t				head;
+	size_t				count;
+	size_t				dropped;
+	int					fd;
+	int					pid;
+}						t_trace;
+
+/**
+ * @brief Exit status of each stage of the last pipeline, like bash's
+ * PIPESTATUS
+ */
+typedef struct s_pipestatus
+{
+	int					*status;
+	int					count;
+	int					cap;
+}						t_pipestatus;
+
+/**
+ * @brief Background job started with `&` (see src/jobs)
+ */
+typedef struct s_job
+{
+	int					id;
+	pid_t				pid;
+	int					state;
+	int					status;
+	char				*text;
+}						t_job;
+
 /**
  * @brief Represents the global context of the app
  */
 typedef struct s_ctx
 {
 	t_quote_state		quote;
-	t_env				*env_list;
+	t_env_store			env;
+	t_bin_cache			bin_cache;
+	t_path_vec			path_vec;
+	t_creds				creds;
 	int					argc;
 	char				**argv;
 	char				**envp;
@@ -130,8 +313,32 @@ typedef struct s_ctx
 	bool				exit_requested;
 	int					fd_file_in;
 	int					fd_file_out;
+	t_reader			*reader;
+	t_arena				arena;
+	size_t				expansions;
+	t_strbuf			expand_buf;
+	t_outbuf			out;
+	t_trace				trace;
+	bool				show_stats;
+	bool				no_spawn;
+	t_job				jobs[JOB_MAX];
+	int					job_count;
+	pid_t				last_bg_pid;
+	t_pipestatus		pipestatus;
+	bool				pipefail;
+	bool				lastpipe;
 }						t_ctx;
 
+/**
+ * @brief Entry of the builtin registry (see builtin_registry.c)
+ */
+typedef struct s_builtin
+{
+	const char			*name;
+	int					(*run)(t_ctx *ctx, t_command *cmd);
+	int					flags;
+}						t_builtin;
+
 /**
  * @brief Helper struct to track position data during processing.
  * @note Used in env management
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 13:52:22 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:05:51 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:13:46 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,6 +15,25 @@
 
 # include "error.h" // for t_path_error
 # include "minishell.h"
+# include <sys/inotify.h> // inotify, for path_watch.c
+
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define BIN_CACHE_MIN 32
+
+/* O_PATH needs _GNU_SOURCE before the first include (see bin_find_path.c) */
+# ifdef O_PATH
+#  define PATH_DIR_FLAGS (O_PATH | O_DIRECTORY | O_CLOEXEC)
+# else
+#  define PATH_DIR_FLAGS (O_RDONLY | O_DIRECTORY | O_CLOEXEC)
+# endif
+
+/* Changes of a watched PATH directory (see path_watch.c) */
+# define PATH_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO \
+	| IN_ATTRIB | IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR)
+# define PATH_WATCH_BUF 4096
 
 // *************************************************************************** #
 //                            Function Prototypes                              #
@@ -29,8 +48,43 @@ bool	is_path(const char *str);
 char	*check_relative_path(char *bin, t_path_error *error_state);
 void	display_path_error(char *bin, t_path_error error_state);
 
+// bin_cache.c
+t_bin_entry	*bin_cache_get(t_bin_cache *cache, const char *name);
+t_bin_entry	*bin_cache_put(t_bin_cache *cache, const char *name,
+				const char *path);
+
+// bin_cache_utils.c
+void		bin_cache_init(t_bin_cache *cache);
+void		bin_cache_clear(t_bin_cache *cache);
+t_bin_entry	*bin_cache_resolve(t_ctx *ctx, char *name);
+void		bin_cache_prepare(t_ctx *ctx, t_command *cmd);
+void		bin_cache_env_changed(t_ctx *ctx, const char *key);
+
 // bin_find_path.c
-char	*bin_find_path(const char *dir, char *bin);
+int		path_dir_fd(t_path_dir *dir);
+char	*bin_find_path(t_ctx *ctx, t_path_dir *dir, const char *bin);
+
+// bin_cache_epoch.c
+unsigned long	path_vec_epoch(t_ctx *ctx);
+void			bin_cache_miss(t_ctx *ctx, const char *name,
+					unsigned long epoch);
+void			bin_cache_hit(t_ctx *ctx, t_bin_entry *entry);
+bool			bin_cache_valid(t_ctx *ctx, t_bin_entry *entry);
+
+// path_exec.c
+void	creds_init(t_creds *creds);
+void	creds_clear(t_creds *creds);
+bool	creds_can_exec(const t_creds *creds, const struct stat *st);
+
+// path_vec.c
+t_path_vec	*path_vec_get(t_ctx *ctx);
+void		path_vec_clear(t_path_vec *vec);
+
+// path_watch.c
+void	path_watch_open(t_path_vec *vec);
+void	path_watch_close(t_path_vec *vec);
+void	path_watch_add(t_path_vec *vec, t_path_dir *dir);
+void	path_watch_poll(t_ctx *ctx);
 
 // path_error.c
 int		handle_path_error(char *path, t_error_type err_type);
@@ -0,0 +1,42 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:27:26 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:27:26 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#ifndef TRACE_H
+# define TRACE_H
+
+# include "minishell.h"
+# include <time.h> // clock_gettime
+
+// *************************************************************************** #
+//                                   Macros                                    #
+// *************************************************************************** #
+
+# define TRACE_RING 4096
+
+// *************************************************************************** #
+//                            Function Prototypes                              #
+// *************************************************************************** #
+
+// trace.c
+void	trace_init(t_ctx *ctx);
+void	trace_event(t_ctx *ctx, const char *name, char phase);
+void	trace_begin(t_ctx *ctx, const char *name);
+void	trace_end(t_ctx *ctx, const char *name);
+pid_t	trace_fork(t_ctx *ctx);
+
+// trace_flush.c
+void	trace_flush(t_ctx *ctx);
+void	trace_exec(t_ctx *ctx);
+void	trace_close(t_ctx *ctx);
+
+#endif
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2024/11/04 14:51:48 by maximart          #+#    #+#             */
-/*   Updated: 2025/03/26 17:47:14 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:58:20 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -21,6 +21,9 @@
 #  define OPEN_MAX 1024
 # endif
 
+# define STRBUF_MIN 64
+# define OUTBUF_SIZE 4096
+
 # include <fcntl.h>
 # include <stdarg.h>
 # include <stdint.h>
@@ -39,6 +42,20 @@ typedef struct s_format
 	char			conversion;
 }					t_format;
 
+typedef struct s_strbuf
+{
+	char			*data;
+	size_t			len;
+	size_t			cap;
+}					t_strbuf;
+
+typedef struct s_outbuf
+{
+	int				fd;
+	size_t			len;
+	char			data[OUTBUF_SIZE];
+}					t_outbuf;
+
 int					ft_putnbr(int n);
 int					ft_toupper(int c);
 int					ft_tolower(int c);
@@ -68,6 +85,11 @@ int					ft_check_args(int fd, t_format fmt, va_list args);
 int					ft_handle_hexa(int fd, unsigned int n, t_format fmt);
 int					ft_memcmp(const void *s1, const void *s2, size_t n);
 int					ft_strncmp(const char *s1, const char *s2, size_t n);
+int					ft_strbuf_append(t_strbuf *sb, const char *s, size_t n);
+int					ft_outbuf_flush(t_outbuf *ob);
+int					ft_outbuf_putstr(t_outbuf *ob, const char *s);
+int					ft_outbuf_write(t_outbuf *ob, const char *s, size_t n);
+int					ft_buf_printf(t_outbuf *ob, const char *format, ...);
 
 size_t				ft_strlen(const char *s);
 size_t				count_words(const char *s, char c);
@@ -90,6 +112,10 @@ char				*ft_strnstr(const char *big, const char *little,
 						size_t len);
 
 void				ft_bzero(void *s, size_t n);
+void				ft_strbuf_init(t_strbuf *sb);
+void				ft_strbuf_free(t_strbuf *sb);
+void				ft_strbuf_clear(t_strbuf *sb);
+void				ft_outbuf_init(t_outbuf *ob, int fd);
 int					ft_putnbr_fd(int n, int fd);
 void				ft_putendl_fd(char *s, int fd);
 void				free_words(char **words, size_t i);
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_buf_printf.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:53:29 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:18:48 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "../include/libft.h"
+
+static int	ft_buf_putnbr(t_outbuf *ob, unsigned long u, int negative,
+		const char *set)
+{
+	char			digits[24];
+	int				i;
+	unsigned long	base;
+
+	base = ft_strlen(set);
+	i = 24;
+	digits[--i] = set[u % base];
+	while (u >= base)
+	{
+		u /= base;
+		digits[--i] = set[u % base];
+	}
+	if (negative)
+		digits[--i] = '-';
+	return (ft_outbuf_write(ob, digits + i, 24 - i));
+}
+
+static int	ft_buf_number(t_outbuf *ob, char c, int is_long, va_list *args)
+{
+	long			n;
+	unsigned long	u;
+
+	if (c == 'd' || c == 'i')
+	{
+		if (is_long)
+			n = va_arg(*args, long);
+		else
+			n = va_arg(*args, int);
+		if (n < 0)
+			return (ft_buf_putnbr(ob, -(unsigned long)n, 1, "0123456789"));
+		return (ft_buf_putnbr(ob, n, 0, "0123456789"));
+	}
+	if (is_long)
+		u = va_arg(*args, unsigned long);
+	else
+		u = va_arg(*args, unsigned int);
+	if (c == 'x')
+		return (ft_buf_putnbr(ob, u, 0, "0123456789abcdef"));
+	if (c == 'X')
+		return (ft_buf_putnbr(ob, u, 0, "0123456789ABCDEF"));
+	return (ft_buf_putnbr(ob, u, 0, "0123456789"));
+}
+
+static int	ft_buf_conversion(t_outbuf *ob, const char *spec, va_list *args)
+{
+	char	ch;
+
+	if (spec[0] == 'l' && spec[1] && ft_strchr("diuxX", spec[1]))
+		return (ft_buf_number(ob, spec[1], 1, args));
+	if (spec[0] == 'l')
+		return (0);
+	if (ft_strchr("diuxX", spec[0]))
+		return (ft_buf_number(ob, spec[0], 0, args));
+	if (spec[0] == 's')
+		return (ft_outbuf_putstr(ob, va_arg(*args, char *)));
+	if (spec[0] == 'c')
+	{
+		ch = (char)va_arg(*args, int);
+		return (ft_outbuf_write(ob, &ch, 1));
+	}
+	if (spec[0] == '%')
+		return (ft_outbuf_write(ob, "%", 1));
+	return (0);
+}
+
+int	ft_buf_printf(t_outbuf *ob, const char *format, ...)
+{
+	int		count;
+	size_t	run;
+	va_list	args;
+
+	count = 0;
+	va_start(args, format);
+	while (*format)
+	{
+		run = 0;
+		while (format[run] && !(format[run] == '%' && format[run + 1]))
+			run++;
+		if (run)
+			count += ft_outbuf_write(ob, format, run);
+		format += run;
+		if (*format == '%')
+		{
+			count += ft_buf_conversion(ob, format + 1, &args);
+			format += 2;
+			if (format[-1] == 'l' && *format && ft_strchr("diuxX", *format))
+				format++;
+		}
+	}
+	va_end(args);
+	return (count);
+}
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_outbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:51:52 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 12:51:52 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "../include/libft.h"
+#include <errno.h>
+
+void	ft_outbuf_init(t_outbuf *ob, int fd)
+{
+	ob->fd = fd;
+	ob->len = 0;
+}
+
+static int	write_all(int fd, const char *s, size_t n)
+{
+	size_t	done;
+	ssize_t	written;
+
+	done = 0;
+	while (done < n)
+	{
+		written = write(fd, s + done, n - done);
+		if (written == 0 || (written < 0 && errno != EINTR))
+			return (-1);
+		if (written > 0)
+			done += written;
+	}
+	return (0);
+}
+
+int	ft_outbuf_flush(t_outbuf *ob)
+{
+	int	status;
+
+	status = write_all(ob->fd, ob->data, ob->len);
+	ob->len = 0;
+	return (status);
+}
+
+int	ft_outbuf_write(t_outbuf *ob, const char *s, size_t n)
+{
+	if (ob->len + n > OUTBUF_SIZE && ft_outbuf_flush(ob) == -1)
+		return (-1);
+	if (n >= OUTBUF_SIZE)
+	{
+		if (write_all(ob->fd, s, n) == -1)
+			return (-1);
+		return (n);
+	}
+	ft_memcpy(ob->data + ob->len, s, n);
+	ob->len += n;
+	return (n);
+}
+
+int	ft_outbuf_putstr(t_outbuf *ob, const char *s)
+{
+	if (!s)
+		s = "(null)";
+	return (ft_outbuf_write(ob, s, ft_strlen(s)));
+}
@@ -0,0 +1,65 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_strbuf.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:29:25 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 11:29:25 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "../include/libft.h"
+
+void	ft_strbuf_init(t_strbuf *sb)
+{
+	sb->data = NULL;
+	sb->len = 0;
+	sb->cap = 0;
+}
+
+static int	ft_strbuf_grow(t_strbuf *sb, size_t need)
+{
+	size_t	cap;
+	char	*data;
+
+	cap = sb->cap;
+	if (cap == 0)
+		cap = STRBUF_MIN;
+	while (cap < need)
+		cap *= 2;
+	data = malloc(cap);
+	if (!data)
+		return (0);
+	if (sb->len)
+		ft_memcpy(data, sb->data, sb->len);
+	free(sb->data);
+	sb->data = data;
+	sb->cap = cap;
+	return (1);
+}
+
+int	ft_strbuf_append(t_strbuf *sb, const char *s, size_t n)
+{
+	if (sb->len + n + 1 > sb->cap && !ft_strbuf_grow(sb, sb->len + n + 1))
+		return (0);
+	ft_memcpy(sb->data + sb->len, s, n);
+	sb->len += n;
+	sb->data[sb->len] = '\0';
+	return (1);
+}
+
+void	ft_strbuf_clear(t_strbuf *sb)
+{
+	sb->len = 0;
+	if (sb->data)
+		sb->data[0] = '\0';
+}
+
+void	ft_strbuf_free(t_strbuf *sb)
+{
+	free(sb->data);
+	ft_strbuf_init(sb);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 10:01:40 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 13:58:24 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:18:17 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -51,7 +51,6 @@ static char	*get_current_pwd(void)
  */
 static void	update_environment_vars(t_ctx *ctx, char *old_pwd)
 {
-	t_env	*old_pwd_node;
 	char	*new_pwd;
 
 	new_pwd = getcwd(NULL, 0);
@@ -60,8 +59,8 @@ static void	update_environment_vars(t_ctx *ctx, char *old_pwd)
 		free(old_pwd);
 		return ;
 	}
-	old_pwd_node = update_pwd_variable(ctx->env_list, new_pwd);
-	update_oldpwd_variable(old_pwd_node, old_pwd);
+	update_pwd_variable(&ctx->env, new_pwd);
+	update_oldpwd_variable(&ctx->env, old_pwd);
 }
 
 /**
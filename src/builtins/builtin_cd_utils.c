@@ -6,11 +6,12 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/24 16:47:07 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:07:52 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:42:32 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "builtins.h"
+#include "env.h"
 #include "error.h"
 
 /**
@@ -23,13 +24,9 @@ char	*get_old_pwd(t_ctx *ctx)
 {
 	t_env	*env_node;
 
-	env_node = ctx->env_list;
-	while (env_node)
-	{
-		if (ft_strncmp(env_node->key, "OLDPWD", ft_strlen("OLDPWD") + 1) == 0)
-			return (ft_strdup(env_node->value));
-		env_node = env_node->next;
-	}
+	env_node = env_lookup(&ctx->env, "OLDPWD", 6);
+	if (env_node)
+		return (ft_strdup(env_node->value));
 	(void)error(NULL, "cd", ERR_NO_OLDPWD);
 	return (NULL);
 }
@@ -44,13 +41,9 @@ char	*get_home_dir(t_ctx *ctx)
 {
 	t_env	*env_node;
 
-	env_node = ctx->env_list;
-	while (env_node)
-	{
-		if (ft_strncmp(env_node->key, "HOME", ft_strlen("HOME") + 1) == 0)
-			return (ft_strdup(env_node->value));
-		env_node = env_node->next;
-	}
+	env_node = env_lookup(&ctx->env, "HOME", 4);
+	if (env_node)
+		return (ft_strdup(env_node->value));
 	(void)error(NULL, "cd", ERR_NO_HOME);
 	return (NULL);
 }
@@ -58,49 +51,34 @@ char	*get_home_dir(t_ctx *ctx)
 /**
  * @brief Updates PWD environment variable
  *
- * @param env_node Current environment node
- * @param new_pwd New PWD value
- * @return t_env* Pointer to OLDPWD node if found, NULL otherwise
+ * @param env Environment store
+ * @param new_pwd New PWD value, freed if PWD is not set
  */
-t_env	*update_pwd_variable(t_env *env_node, char *new_pwd)
+void	update_pwd_variable(t_env_store *env, char *new_pwd)
 {
-	t_env	*old_pwd_node;
-	bool	pwd_found;
+	t_env	*pwd_node;
 
-	old_pwd_node = NULL;
-	pwd_found = false;
-	while (env_node)
-	{
-		if (ft_strncmp(env_node->key, "PWD", ft_strlen("PWD") + 1) == 0)
-		{
-			free(env_node->value);
-			env_node->value = new_pwd;
-			pwd_found = true;
-		}
-		else if (ft_strncmp(env_node->key, "OLDPWD", ft_strlen("OLDPWD")
-				+ 1) == 0)
-			old_pwd_node = env_node;
-		env_node = env_node->next;
-	}
-	if (!pwd_found)
+	pwd_node = env_lookup(env, "PWD", 3);
+	if (pwd_node)
+		env_assign(env, pwd_node, new_pwd);
+	else
 		free(new_pwd);
-	return (old_pwd_node);
 }
 
 /**
  * @brief Updates OLDPWD environment variable
  *
- * @param old_pwd_node OLDPWD environment node
- * @param old_pwd Old PWD value
+ * @param env Environment store
+ * @param old_pwd Old PWD value, freed if OLDPWD is not set
  * @return void
  */
-void	update_oldpwd_variable(t_env *old_pwd_node, char *old_pwd)
+void	update_oldpwd_variable(t_env_store *env, char *old_pwd)
 {
+	t_env	*old_pwd_node;
+
+	old_pwd_node = env_lookup(env, "OLDPWD", 6);
 	if (old_pwd_node && old_pwd)
-	{
-		free(old_pwd_node->value);
-		old_pwd_node->value = old_pwd;
-	}
+		env_assign(env, old_pwd_node, old_pwd);
 	else if (old_pwd)
 		free(old_pwd);
 }
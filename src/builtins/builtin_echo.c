@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 09:54:10 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:59:57 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -46,7 +46,6 @@ int	builtin_echo(t_ctx *ctx, t_command *cmd)
 	int		i;
 	bool	new_line;
 
-	(void)ctx;
 	new_line = true;
 	i = 1;
 	while (i <= cmd->arg_count && is_n_option(cmd->args[i]))
@@ -56,12 +55,12 @@ int	builtin_echo(t_ctx *ctx, t_command *cmd)
 	}
 	while (i <= cmd->arg_count)
 	{
-		ft_printf(cmd->args[i], STDOUT_FILENO);
+		ft_outbuf_putstr(&ctx->out, cmd->args[i]);
 		if (i < cmd->arg_count)
-			ft_putchar_fd(' ', STDOUT_FILENO);
+			ft_outbuf_write(&ctx->out, " ", 1);
 		i++;
 	}
 	if (new_line)
-		ft_putchar_fd('\n', STDOUT_FILENO);
+		ft_outbuf_write(&ctx->out, "\n", 1);
 	return (0);
 }
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 09:56:54 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 13:33:17 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:01:34 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -24,11 +24,11 @@ int	builtin_env(t_ctx *ctx, t_command *cmd)
 	t_env	*env;
 
 	(void)cmd;
-	env = ctx->env_list;
+	env = ctx->env.head;
 	while (env)
 	{
 		if (env->value)
-			ft_printf("%s=%s\n", env->key, env->value);
+			ft_buf_printf(&ctx->out, "%s=%s\n", env->key, env->value);
 		env = env->next;
 	}
 	return (0);
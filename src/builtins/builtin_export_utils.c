@@ -6,11 +6,11 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/24 12:37:35 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:03:11 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minishell.h"
+#include "env.h"
 
 /**
  * @brief Checks if a character is valid for env variable name
@@ -56,13 +56,13 @@ void	print_export_env(t_ctx *ctx)
 {
 	t_env	*env;
 
-	env = ctx->env_list;
+	env = ctx->env.head;
 	while (env)
 	{
-		ft_printf("declare -x %s", env->key);
+		ft_buf_printf(&ctx->out, "declare -x %s", env->key);
 		if (env->value)
-			ft_printf("=\"%s\"", env->value);
-		ft_printf("\n");
+			ft_buf_printf(&ctx->out, "=\"%s\"", env->value);
+		ft_outbuf_write(&ctx->out, "\n", 1);
 		env = env->next;
 	}
 }
@@ -70,33 +70,27 @@ void	print_export_env(t_ctx *ctx)
 /**
  * @brief Updates an existing environment variable
  *
- * @param env_list Pointer to environment list
+ * @param env Environment store
  * @param key Key to update
  * @param value New value
  * @param has_equals Whether the variable has an equals sign
  * @return bool true if updated, false if not found
  */
-bool	update_env_var(t_env **env_list, char *key, char *value,
+bool	update_env_var(t_env_store *env, char *key, char *value,
 		bool has_equals)
 {
 	t_env	*current;
+	char	*new_value;
 
-	current = *env_list;
-	while (current)
+	current = env_lookup(env, key, ft_strlen(key));
+	if (!current)
+		return (false);
+	if (has_equals)
 	{
-		if (ft_strncmp(current->key, key, ft_strlen(key) + 1) == 0)
-		{
-			if (has_equals)
-			{
-				if (current->value)
-					free(current->value);
-				current->value = NULL;
-				if (value)
-					current->value = ft_strdup(value);
-			}
-			return (true);
-		}
-		current = current->next;
+		new_value = NULL;
+		if (value)
+			new_value = ft_strdup(value);
+		env_assign(env, current, new_value);
 	}
-	return (false);
+	return (true);
 }
@@ -6,18 +6,22 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 17:05:56 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 15:05:07 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:22:02 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "builtins.h"
 #include "error.h"
-#include "init.h"  // for add_env_var
+#include "env.h"   // for add_env_var
 #include "lexer.h" // for t_parse
+#include "path.h"  // for bin_cache_env_changed
 
 /**
  * @brief Extracts and validates the key and value from an export argument
  *
+ * PIPESTATUS is read-only: it is computed from the last pipeline (see
+ * env_expand.c), so an assignment would be ignored.
+ *
  * @param arg Argument to process (format key=value)
  * @param key_ptr Pointer to store the extracted key
  * @param value_ptr Pointer to store the extracted value
@@ -37,6 +41,13 @@ int	extract_export_data(char *arg, char **key_ptr, char **value_ptr,
 		*key_ptr = NULL;
 		return (1);
 	}
+	if (ft_strncmp(*key_ptr, "PIPESTATUS", 11) == 0)
+	{
+		(void)error(*key_ptr, "export", ERR_READONLY);
+		free(*key_ptr);
+		*key_ptr = NULL;
+		return (1);
+	}
 	*has_equals_ptr = (ft_strchr(arg, '=') != NULL);
 	*value_ptr = NULL;
 	if (*has_equals_ptr)
@@ -57,9 +68,11 @@ int	update_or_add_env_var(t_ctx *ctx, char *key, char *value, bool has_equals)
 {
 	int	result;
 
-	if (!update_env_var(&ctx->env_list, key, value, has_equals))
-		result = add_env_var(&ctx->env_list, key, value);
+	if (!update_env_var(&ctx->env, key, value, has_equals))
+		result = add_env_var(&ctx->env, key, value);
 	else
 		result = 1;
+	if (has_equals)
+		bin_cache_env_changed(ctx, key);
 	return (result);
 }
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:58:42 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 15:33:32 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "builtins.h"
+#include "error.h"
+#include "path.h"
+
+/**
+ * @brief Checks if the cache holds any resolved path, misses aside
+ *
+ * @param cache Command cache
+ * @return bool true if at least one command is hashed
+ */
+static bool	hash_has_paths(t_bin_cache *cache)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < cache->cap)
+	{
+		if (cache->slots[i] && cache->slots[i]->path)
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Lists the hashed commands in bash's `hits<TAB>command` format
+ *
+ * Remembered misses are not listed.
+ *
+ * @param out Output buffer of the builtin
+ * @param cache Command cache
+ */
+static void	hash_print(t_outbuf *out, t_bin_cache *cache)
+{
+	size_t			i;
+	unsigned int	pad;
+
+	if (!hash_has_paths(cache))
+	{
+		ft_outbuf_putstr(out, "hash: hash table empty\n");
+		return ;
+	}
+	ft_outbuf_putstr(out, "hits\tcommand\n");
+	i = 0;
+	while (i < cache->cap)
+	{
+		if (cache->slots[i] && cache->slots[i]->path)
+		{
+			pad = 1000;
+			while (pad > 1 && cache->slots[i]->hits < pad)
+			{
+				ft_outbuf_write(out, " ", 1);
+				pad /= 10;
+			}
+			ft_buf_printf(out, "%u\t%s\n", cache->slots[i]->hits,
+				cache->slots[i]->path);
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Hashes each remaining argument by searching PATH for it
+ *
+ * @param ctx Shell context
+ * @param cmd Command containing arguments
+ * @param i Index of the first name
+ * @return int 0 if every name was found, 1 otherwise
+ */
+static int	hash_names(t_ctx *ctx, t_command *cmd, int i)
+{
+	t_bin_entry	*entry;
+	int			status;
+
+	status = 0;
+	while (i <= cmd->arg_count)
+	{
+		if (!is_path(cmd->args[i]))
+		{
+			entry = bin_cache_resolve(ctx, cmd->args[i]);
+			if (!entry)
+				status = error(cmd->args[i], "hash", ERR_NOT_FOUND);
+			else
+				entry->hits = 0;
+		}
+		i++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Handles `hash -p path name`
+ *
+ * @param ctx Shell context
+ * @param cmd Command containing arguments
+ * @param i Index of the `-p` option
+ * @return int Exit status
+ */
+static int	hash_add_path(t_ctx *ctx, t_command *cmd, int i)
+{
+	if (i + 2 > cmd->arg_count)
+		return (error("-p", "hash", ERR_OPTION_ARG));
+	if (is_directory(cmd->args[i + 1]))
+		return (error(cmd->args[i + 1], "hash", ERR_IS_DIR));
+	if (!bin_cache_put(&ctx->bin_cache, cmd->args[i + 2], cmd->args[i + 1]))
+		return (error(NULL, "hash", ERR_ALLOC));
+	return (0);
+}
+
+/**
+ * @brief Executes the hash built-in command
+ *
+ * `hash` lists the cache, `hash -r` empties it, `hash -p path name` adds
+ * an entry by hand and `hash name...` looks names up in PATH.
+ *
+ * @param ctx Context for shell environment
+ * @param cmd Command containing arguments
+ * @return int Exit status (0 for success, non-zero for error)
+ */
+int	builtin_hash(t_ctx *ctx, t_command *cmd)
+{
+	int	i;
+
+	i = 1;
+	while (i <= cmd->arg_count && cmd->args[i][0] == '-' && cmd->args[i][1])
+	{
+		if (ft_strncmp(cmd->args[i], "--", 3) == 0)
+		{
+			i++;
+			break ;
+		}
+		if (ft_strncmp(cmd->args[i], "-p", 3) == 0)
+			return (hash_add_path(ctx, cmd, i));
+		if (ft_strncmp(cmd->args[i], "-r", 3) != 0)
+			return (error(cmd->args[i], "hash", ERR_INVALID_OPTION));
+		bin_cache_clear(&ctx->bin_cache);
+		i++;
+	}
+	if (cmd->arg_count < 1)
+		hash_print(&ctx->out, &ctx->bin_cache);
+	return (hash_names(ctx, cmd, i));
+}
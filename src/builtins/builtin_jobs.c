@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_jobs.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:54:55 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:54:55 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "error.h"
+#include "jobs.h"
+
+/**
+ * @brief Lists one job, forgetting it if it has finished
+ *
+ * @param ctx Shell context
+ * @param index Index of the job in the table
+ * @return bool true if the job was forgotten
+ */
+static bool	job_show(t_ctx *ctx, int index)
+{
+	job_print(&ctx->out, &ctx->jobs[index]);
+	if (ctx->jobs[index].state != JOB_DONE)
+		return (false);
+	job_remove(ctx, index);
+	return (true);
+}
+
+/**
+ * @brief Lists every job
+ *
+ * @param ctx Shell context
+ * @return int Always 0
+ */
+static int	jobs_show_all(t_ctx *ctx)
+{
+	int	i;
+
+	i = 0;
+	while (i < ctx->job_count)
+	{
+		if (!job_show(ctx, i))
+			i++;
+	}
+	return (0);
+}
+
+/**
+ * @brief Executes the jobs built-in command
+ *
+ * `jobs` lists every background job and `jobs %n...` the ones named.
+ * Finished jobs are forgotten once they have been listed.
+ *
+ * @param ctx Context for shell environment
+ * @param cmd Command containing arguments
+ * @return int Exit status (0 for success, 1 if a job does not exist)
+ */
+int	builtin_jobs(t_ctx *ctx, t_command *cmd)
+{
+	int	i;
+	int	index;
+	int	status;
+
+	jobs_reap(ctx);
+	if (cmd->arg_count == 0)
+		return (jobs_show_all(ctx));
+	status = 0;
+	i = 1;
+	while (i <= cmd->arg_count)
+	{
+		index = job_find(ctx, cmd->args[i]);
+		if (index >= 0)
+			job_show(ctx, index);
+		else
+		{
+			error(cmd->args[i], "jobs", ERR_NO_JOB);
+			status = 1;
+		}
+		i++;
+	}
+	return (status);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 09:54:32 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:00:06 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:17:44 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -15,16 +15,19 @@
 /**
  * @brief Executes the pwd built-in command
  *
+ * @param ctx Shell context, whose output buffer receives the path
+ * @param cmd Command containing arguments (unused)
  * @return int Exit status (0 for success, non-zero for error)
  */
-int	builtin_pwd(void)
+int	builtin_pwd(t_ctx *ctx, t_command *cmd)
 {
 	char	*pwd;
 
+	(void)cmd;
 	pwd = getcwd(NULL, 0);
 	if (!pwd)
 		return (error(NULL, "pwd", ERR_NO_PWD));
-	ft_printf("%s\n", pwd);
+	ft_buf_printf(&ctx->out, "%s\n", pwd);
 	free(pwd);
 	return (0);
 }
@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_registry.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:11:16 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:51:08 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "builtins.h"
+
+/**
+ * @brief Hashes a builtin name into the registry index
+ *
+ * @param name Command name
+ * @param len Length of the name
+ * @return unsigned int Slot in [0, BUILTIN_SLOTS)
+ */
+static unsigned int	builtin_slot(const char *name, size_t len)
+{
+	return ((len + 2 * (unsigned char)name[0]
+			+ 2 * (unsigned char)name[len - 1]) % BUILTIN_SLOTS);
+}
+
+/**
+ * @brief Lists the builtins, in no particular order
+ *
+ * @return const t_builtin* Entries, ended by one without a name
+ */
+static const t_builtin	*builtin_list(void)
+{
+	static const t_builtin	list[] = {
+	{"cd", builtin_cd, BUILTIN_PARENT},
+	{"echo", builtin_echo, 0},
+	{"env", builtin_env, 0},
+	{"exit", builtin_exit, BUILTIN_PARENT},
+	{"export", builtin_export, BUILTIN_PARENT},
+	{"hash", builtin_hash, BUILTIN_PARENT},
+	{"jobs", builtin_jobs, BUILTIN_PARENT},
+	{"pwd", builtin_pwd, 0},
+	{"set", builtin_set, BUILTIN_PARENT},
+	{"unset", builtin_unset, BUILTIN_PARENT},
+	{"wait", builtin_wait, BUILTIN_PARENT},
+	{NULL, NULL, 0},
+	};
+
+	return (list);
+}
+
+/**
+ * @brief Places every builtin of the list in the index
+ *
+ * Names that hash to the same slot take the next free one, so the slots
+ * are never written by hand and no entry can overwrite another. The index
+ * has more slots than there are builtins (see BUILTIN_SLOTS).
+ *
+ * @param slots Index to fill, all NULL
+ */
+static void	builtin_index_build(const t_builtin **slots)
+{
+	const t_builtin	*entry;
+	unsigned int	slot;
+
+	entry = builtin_list();
+	while (entry->name)
+	{
+		slot = builtin_slot(entry->name, ft_strlen(entry->name));
+		while (slots[slot])
+			slot = (slot + 1) % BUILTIN_SLOTS;
+		slots[slot] = entry;
+		entry++;
+	}
+}
+
+/**
+ * @brief Finds the builtin registered under a name
+ *
+ * The index is built on the first lookup. A lookup is then one hash and,
+ * as long as the index stays sparse, one or two string comparisons; names
+ * of any length go through the same path.
+ *
+ * @param name Command name, may be NULL
+ * @return const t_builtin* Registry entry or NULL if not a builtin
+ */
+const t_builtin	*builtin_lookup(const char *name)
+{
+	static const t_builtin	*slots[BUILTIN_SLOTS];
+	static bool				built;
+	unsigned int			slot;
+	size_t					len;
+
+	if (!built)
+		builtin_index_build(slots);
+	built = true;
+	if (!name)
+		return (NULL);
+	len = ft_strlen(name);
+	if (len == 0)
+		return (NULL);
+	slot = builtin_slot(name, len);
+	while (slots[slot] && ft_strncmp(slots[slot]->name, name, len + 1) != 0)
+		slot = (slot + 1) % BUILTIN_SLOTS;
+	return (slots[slot]);
+}
@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_set.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:53:07 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:10:43 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "error.h"
+
+/**
+ * @brief Finds the flag of a shell option
+ *
+ * @param ctx Shell context
+ * @param name Name of the option
+ * @return bool* Flag in the context, NULL if there is no such option
+ */
+static bool	*set_option(t_ctx *ctx, const char *name)
+{
+	if (ft_strncmp(name, "lastpipe", 9) == 0)
+		return (&ctx->lastpipe);
+	if (ft_strncmp(name, "pipefail", 9) == 0)
+		return (&ctx->pipefail);
+	return (NULL);
+}
+
+/**
+ * @brief Prints one option, as `set -o` or as a command (`set +o`)
+ *
+ * @param out Output buffer
+ * @param name Name of the option
+ * @param on Whether the option is on
+ * @param as_command Whether to print it as a `set` command
+ */
+static void	set_print_option(t_outbuf *out, const char *name, bool on,
+		bool as_command)
+{
+	if (as_command && on)
+		ft_buf_printf(out, "set -o %s\n", name);
+	else if (as_command)
+		ft_buf_printf(out, "set +o %s\n", name);
+	else if (on)
+		ft_buf_printf(out, "%s       \ton\n", name);
+	else
+		ft_buf_printf(out, "%s       \toff\n", name);
+}
+
+/**
+ * @brief Executes the set built-in command
+ *
+ * Only shell options are supported: `set -o name` turns one on, `set +o
+ * name` off, and `set -o` or `set +o` alone lists them. `pipefail` sets
+ * the status of a pipeline from its stages (see pipestatus.c), `lastpipe`
+ * runs a builtin ending a pipeline in the shell (see execute_lastpipe.c).
+ *
+ * @param ctx Context for shell environment
+ * @param cmd Command containing arguments
+ * @return int Exit status (0 for success, 2 for an unknown option)
+ */
+int	builtin_set(t_ctx *ctx, t_command *cmd)
+{
+	int		i;
+	bool	on;
+	bool	*flag;
+
+	i = 1;
+	while (i <= cmd->arg_count)
+	{
+		on = (cmd->args[i][0] == '-');
+		if ((!on && cmd->args[i][0] != '+')
+			|| ft_strncmp(cmd->args[i] + 1, "o", 2) != 0)
+			return (error(cmd->args[i], "set", ERR_INVALID_OPTION));
+		if (i == cmd->arg_count)
+		{
+			set_print_option(&ctx->out, "lastpipe", ctx->lastpipe, !on);
+			set_print_option(&ctx->out, "pipefail", ctx->pipefail, !on);
+			return (0);
+		}
+		flag = set_option(ctx, cmd->args[i + 1]);
+		if (!flag)
+			return (error(cmd->args[i + 1], "set", ERR_INVALID_OPTION));
+		*flag = on;
+		i += 2;
+	}
+	return (0);
+}
@@ -6,11 +6,13 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/21 09:56:32 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:08:24 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "env.h"
 #include "error.h"
+#include "path.h"
 
 /**
  * @brief Checks if a string is a valid environment variable name
@@ -37,39 +39,23 @@ static bool	is_valid_env_name(char *name)
 }
 
 /**
- * @brief Removes an environment variable from the list
+ * @brief Removes an environment variable from the store
  *
- * @param env_list Pointer to environment list
+ * @param env Environment store
  * @param key Key to remove
  * @return bool true if removed, false if not found
  */
-bool	remove_env_var(t_env **env_list, char *key)
+bool	remove_env_var(t_env_store *env, char *key)
 {
 	t_env	*current;
-	t_env	*prev;
 
-	if (!env_list || !*env_list || !key)
+	if (!env || !key)
 		return (false);
-	current = *env_list;
-	prev = NULL;
-	while (current)
-	{
-		if (ft_strncmp(current->key, key, ft_strlen(key) + 1) == 0)
-		{
-			if (prev)
-				prev->next = current->next;
-			else
-				*env_list = current->next;
-			free(current->key);
-			if (current->value)
-				free(current->value);
-			free(current);
-			return (true);
-		}
-		prev = current;
-		current = current->next;
-	}
-	return (false);
+	current = env_lookup(env, key, ft_strlen(key));
+	if (!current)
+		return (false);
+	env_table_delete(env, current);
+	return (true);
 }
 
 /**
@@ -93,8 +79,8 @@ int	builtin_unset(t_ctx *ctx, t_command *cmd)
 			(void)error(cmd->args[i], "unset", ERR_TOO_MANY_ARGS);
 			status = 1;
 		}
-		else
-			remove_env_var(&ctx->env_list, cmd->args[i]);
+		else if (remove_env_var(&ctx->env, cmd->args[i]))
+			bin_cache_env_changed(ctx, cmd->args[i]);
 		i++;
 	}
 	return (status);
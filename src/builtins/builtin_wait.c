@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_wait.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:56:32 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:56:32 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "builtins.h"
+#include "error.h"
+#include "jobs.h"
+
+/**
+ * @brief Waits for every background job
+ *
+ * @param ctx Shell context
+ * @return int Always 0, like bash's `wait` without arguments
+ */
+static int	wait_all(t_ctx *ctx)
+{
+	while (ctx->job_count)
+	{
+		job_wait(ctx, 0);
+		job_remove(ctx, 0);
+	}
+	return (0);
+}
+
+/**
+ * @brief Executes the wait built-in command
+ *
+ * `wait` waits for every background job; `wait %n` or `wait pid` waits for
+ * the ones named and returns the exit status of the last of them.
+ *
+ * @param ctx Context for shell environment
+ * @param cmd Command containing arguments
+ * @return int Exit status of the last job, 127 if it does not exist
+ */
+int	builtin_wait(t_ctx *ctx, t_command *cmd)
+{
+	int	i;
+	int	index;
+	int	status;
+
+	if (cmd->arg_count == 0)
+		return (wait_all(ctx));
+	status = 0;
+	i = 1;
+	while (i <= cmd->arg_count)
+	{
+		index = job_find(ctx, cmd->args[i]);
+		if (index < 0)
+			status = error(cmd->args[i], "wait", ERR_NO_JOB);
+		else
+		{
+			status = job_wait(ctx, index);
+			job_remove(ctx, index);
+		}
+		i++;
+	}
+	return (status);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/26 08:32:58 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:12:42 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -65,8 +65,7 @@ static bool	check_missing_target(t_token *current)
 {
 	if (token_is_redirection(current->type)
 		&& (token_is_redirection(current->next->type)
-			|| current->next->type == TOK_PIPE || current->next->type == TOK_EOF
-			|| current->next->type == TOK_NEW_LINE))
+			|| token_is_missing_operand(current->next->type)))
 	{
 		print_token_error("newline");
 		return (false);
@@ -112,6 +111,8 @@ bool	validate_token_sequence(t_token *tokens)
 {
 	if (!tokens)
 		return (false);
+	if (token_is_separator(tokens->type))
+		return (print_token_error(tokens->value), false);
 	if (!check_invalid_tokens(tokens))
 		return (false);
 	return (true);
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 15:52:57 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:14:19 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,24 +16,27 @@
 /**
  * @brief Checks for errors with &, ||, and && tokens
  *
+ * `&&` and `||` must be followed by a pipeline; `&` may also end the line.
+ * The error names the token found in their place.
+ *
  * @param token The token to check
  * @return bool false if invalid token found, true otherwise
  */
 bool	check_logical_tokens(t_token *token)
 {
-	if (token->type == TOK_ESP)
-	{
-		print_token_error("&");
-		return (false);
-	}
-	if (token->type == TOK_OR)
+	if (token->type == TOK_ESP && (token->next->type == TOK_PIPE
+			|| token_is_separator(token->next->type)))
 	{
-		print_token_error("||");
+		print_token_error(token->next->value);
 		return (false);
 	}
-	if (token->type == TOK_AND)
+	if (token_is_list_operator(token->type)
+		&& token_is_missing_operand(token->next->type))
 	{
-		print_token_error("&&");
+		if (token->next->type == TOK_EOF || token->next->type == TOK_NEW_LINE)
+			print_token_error("newline");
+		else
+			print_token_error(token->next->value);
 		return (false);
 	}
 	return (true);
@@ -90,5 +93,11 @@ bool	check_pipe_tokens(t_token *current)
 		print_token_error("|");
 		return (false);
 	}
+	if (current->type == TOK_PIPE
+		&& token_is_separator(current->next->type))
+	{
+		print_token_error(current->next->value);
+		return (false);
+	}
 	return (true);
 }
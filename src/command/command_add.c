@@ -6,35 +6,36 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/08 13:48:41 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:38:27 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:15:56 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minishell.h"
+#include "memory.h"
 
 /**
  * @brief Adds a redirection to a command
  *
+ * @param arena Line arena owning the redirection
  * @param cmd Command to add redirection to
- * @param type Redirection type (< > << >>)
- * @param filename Target filename
+ * @param op Redirection operator token (< > << >>); a heredoc whose body
+ * was read ahead of time (see heredoc_prefetch.c) hands over its fd
+ * @param filename Target filename, must be owned by the arena as well
  * @return int 0 on success, -1 on failure
  */
-int	command_add_redirection(t_command *cmd, t_token_type type, char *filename)
+int	command_add_redirection(t_arena *arena, t_command *cmd, t_token *op,
+		char *filename)
 {
 	t_redir	*redir;
 	t_redir	*current;
 
 	if (!cmd || !filename)
 		return (-1);
-	redir = malloc(sizeof(t_redir));
+	redir = arena_alloc(arena, sizeof(t_redir));
 	if (!redir)
 		return (-1);
-	redir->type = type;
-	redir->fd = -1;
-	redir->filename = ft_strdup(filename);
-	if (!redir->filename)
-		return (free(redir), -1);
+	redir->type = op->type;
+	redir->fd = op->fd;
+	redir->filename = filename;
 	redir->next = NULL;
 	if (!cmd->redirection)
 		cmd->redirection = redir;
@@ -47,3 +48,17 @@ int	command_add_redirection(t_command *cmd, t_token_type type, char *filename)
 	}
 	return (0);
 }
+
+/**
+ * @brief NULL-terminates the argument vector of a parsed command
+ *
+ * The vector always keeps one spare slot, so this never allocates. It is
+ * done once the command is complete rather than after every word.
+ *
+ * @param cmd Command whose words have all been added
+ */
+void	command_terminate_args(t_command *cmd)
+{
+	if (cmd && cmd->args)
+		cmd->args[cmd->arg_count + 1] = NULL;
+}
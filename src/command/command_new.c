@@ -6,26 +6,28 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/08 13:48:09 by elagouch          #+#    #+#             */
-/*   Updated: 2025/03/21 10:51:25 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:13:04 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minishell.h"
+#include "memory.h"
 
 /**
  * @brief Creates a new command structure
  *
+ * @param arena Line arena owning the command
  * @return t_command* New initialized command or NULL if allocation fails
  */
-t_command	*command_new(void)
+t_command	*command_new(t_arena *arena)
 {
 	t_command	*cmd;
 
-	cmd = (t_command *)malloc(sizeof(t_command));
+	cmd = (t_command *)arena_alloc(arena, sizeof(t_command));
 	if (!cmd)
 		return (NULL);
 	cmd->args = NULL;
 	cmd->arg_count = 0;
+	cmd->arg_cap = 0;
 	cmd->redirection = NULL;
 	cmd->operator = TOK_NONE;
 	cmd->next = NULL;
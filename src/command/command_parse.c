@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/08 13:46:45 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:17:33 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -67,7 +67,7 @@ static bool	handle_token_by_type(t_command *cmd, t_ctx *ctx,
 }
 
 /**
- * @brief Processes tokens until end of command or pipeline marker
+ * @brief Processes tokens until end of command, pipeline or list marker
  *
  * @param current Current token pointer reference
  * @param cmd Current command being built
@@ -84,7 +84,8 @@ static bool	process_command_tokens(t_token **current, t_command *cmd,
 
 	first_arg_processed = false;
 	has_redirections = false;
-	while (*current && (*current)->type != TOK_PIPE)
+	while (*current && (*current)->type != TOK_PIPE
+		&& !token_is_separator((*current)->type))
 	{
 		args = (t_handle_token){current, &first_arg_processed,
 			&has_redirections};
@@ -94,6 +95,7 @@ static bool	process_command_tokens(t_token **current, t_command *cmd,
 		if (*current)
 			*current = (*current)->next;
 	}
+	command_terminate_args(cmd);
 	return (first_arg_processed || has_redirections);
 }
 
@@ -111,7 +113,7 @@ static bool	create_pipeline(t_command **cmd, t_token **current, t_ctx *ctx)
 	t_command	*prev_cmd;
 
 	prev_cmd = *cmd;
-	new_cmd = command_new();
+	new_cmd = command_new(&ctx->arena);
 	if (!new_cmd)
 		return (false);
 	prev_cmd->next = new_cmd;
@@ -132,6 +134,9 @@ static bool	create_pipeline(t_command **cmd, t_token **current, t_ctx *ctx)
 /**
  * @brief Parses tokens into a command structure
  *
+ * Parsing stops at the end of the pipeline, before any `&&`, `||` or `&`, so
+ * the words of the pipelines that follow are not expanded yet.
+ *
  * @param ctx Context containing environment information
  * @param tokens The tokens array to parse
  * @return t_command* Parsed command structure or NULL if parsing fails
@@ -142,7 +147,7 @@ t_command	*command_parse(t_ctx *ctx, t_token *tokens)
 	t_command	*first_cmd;
 	t_token		*current;
 
-	cmd = command_new();
+	cmd = command_new(&ctx->arena);
 	if (!cmd)
 		return (NULL);
 	first_cmd = cmd;
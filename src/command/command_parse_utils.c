@@ -6,74 +6,56 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/24 15:27:42 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:22:46 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "commands.h"
 #include "env.h"
+#include "memory.h"
 
 /**
- * @brief Creates a new arguments array for the first command argument
+ * @brief Doubles the capacity of the arguments vector
  *
- * @param expanded_value The value to set as the first argument
- * @return char** Newly allocated args array or NULL on failure
- */
-static char	**create_first_arg(char *expanded_value)
-{
-	char	**new_args;
-
-	new_args = malloc(sizeof(char *) * 2);
-	if (!new_args)
-		return (NULL);
-	new_args[0] = expanded_value;
-	new_args[1] = NULL;
-	return (new_args);
-}
-
-/**
- * @brief Creates and populates a new arguments array with additional slot
+ * The arena cannot resize in place, so the pointers are copied to a new
+ * block; doubling keeps the total cost linear in the number of words.
  *
- * @param cmd Command structure containing current args
- * @param expanded_value New value to add to args array
- * @return char** New args array or NULL on failure
+ * @param arena Line arena owning the vector
+ * @param cmd Command whose vector is full
+ * @param used Number of slots currently in use
+ * @return bool true on success, false on allocation failure
  */
-static char	**create_extended_args(t_command *cmd, char *expanded_value)
+static bool	grow_args(t_arena *arena, t_command *cmd, int used)
 {
 	char	**new_args;
-	int		i;
+	int		new_cap;
 
-	new_args = malloc(sizeof(char *) * (cmd->arg_count + 3));
+	new_cap = cmd->arg_cap * 2;
+	if (new_cap < ARGS_MIN)
+		new_cap = ARGS_MIN;
+	new_args = arena_alloc(arena, sizeof(char *) * new_cap);
 	if (!new_args)
-		return (NULL);
-	i = 0;
-	while (i <= cmd->arg_count)
-	{
-		new_args[i] = cmd->args[i];
-		i++;
-	}
-	new_args[i] = expanded_value;
-	new_args[i + 1] = NULL;
-	return (new_args);
+		return (false);
+	if (used > 0)
+		ft_memcpy(new_args, cmd->args, sizeof(char *) * used);
+	cmd->args = new_args;
+	cmd->arg_cap = new_cap;
+	return (true);
 }
 
 /**
  * @brief Handles the case when args array is not yet initialized
  *
+ * @param arena Line arena owning the args array
  * @param cmd Command structure being built
  * @param expanded_value Expanded token value to add
  * @return bool true on success, false on failure
  */
-bool	handle_first_arg(t_command *cmd, char *expanded_value)
+bool	handle_first_arg(t_arena *arena, t_command *cmd, char *expanded_value)
 {
-	char	**new_args;
-
-	new_args = create_first_arg(expanded_value);
-	if (!new_args)
-	{
-		free(expanded_value);
+	if (cmd->arg_cap < 2 && !grow_args(arena, cmd, 0))
 		return (false);
-	}
-	cmd->args = new_args;
+	cmd->args[0] = expanded_value;
 	cmd->arg_count = 0;
 	return (true);
 }
@@ -81,26 +63,40 @@ bool	handle_first_arg(t_command *cmd, char *expanded_value)
 /**
  * @brief Adds a new argument to an existing args array
  *
+ * A slot is always left free after the last argument for the terminating
+ * NULL written by command_terminate_args().
+ *
+ * @param arena Line arena owning the args array
  * @param cmd Command structure being built
  * @param expanded_value Expanded token value to add
  * @return bool true on success, false on failure
  */
-bool	add_to_existing_args(t_command *cmd, char *expanded_value)
+bool	add_to_existing_args(t_arena *arena, t_command *cmd,
+		char *expanded_value)
 {
-	char	**new_args;
-
-	new_args = create_extended_args(cmd, expanded_value);
-	if (!new_args)
-	{
-		free(expanded_value);
+	if (cmd->arg_count + 2 >= cmd->arg_cap
+		&& !grow_args(arena, cmd, cmd->arg_count + 1))
 		return (false);
-	}
-	free(cmd->args);
-	cmd->args = new_args;
 	cmd->arg_count++;
+	cmd->args[cmd->arg_count] = expanded_value;
 	return (true);
 }
 
+/**
+ * @brief Appends an already expanded word to the command arguments
+ *
+ * @param arena Line arena owning the args array
+ * @param cmd Command structure being built
+ * @param expanded_value Expanded word, owned by the arena
+ * @return bool true on success, false on failure
+ */
+bool	add_expanded_arg(t_arena *arena, t_command *cmd, char *expanded_value)
+{
+	if (!cmd->args)
+		return (handle_first_arg(arena, cmd, expanded_value));
+	return (add_to_existing_args(arena, cmd, expanded_value));
+}
+
 /**
  * @brief Processes a word token during command parsing
  *
@@ -116,7 +112,5 @@ bool	process_word_token(t_command *cmd, t_token *token, t_ctx *ctx)
 	expanded_value = handle_quotes_and_vars(ctx, token);
 	if (!expanded_value)
 		return (false);
-	if (!cmd->args)
-		return (handle_first_arg(cmd, expanded_value));
-	return (add_to_existing_args(cmd, expanded_value));
+	return (add_expanded_arg(&ctx->arena, cmd, expanded_value));
 }
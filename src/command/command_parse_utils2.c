@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 18:07:56 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:19:10 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -33,14 +33,15 @@ int	handle_redirection_token(t_command *cmd, t_token *token,
 	if (next_token->type != TOK_WORD)
 		return (-1);
 	if (token->type == TOK_HERE_DOC_FROM)
-		result = command_add_redirection(cmd, token->type, next_token->value);
+		result = command_add_redirection(&ctx->arena, cmd, token,
+				next_token->value);
 	else
 	{
 		expanded_filename = handle_quotes_and_vars(ctx, next_token);
 		if (!expanded_filename)
 			return (-1);
-		result = command_add_redirection(cmd, token->type, expanded_filename);
-		free(expanded_filename);
+		result = command_add_redirection(&ctx->arena, cmd, token,
+				expanded_filename);
 	}
 	return (result);
 }
@@ -67,6 +68,9 @@ bool	handle_empty_first_arg(t_command *cmd, t_token **current, t_ctx *ctx)
 /**
  * @brief Processes word token and handles first token case
  *
+ * The token is expanded once here; the result is either dropped (empty
+ * command name) or stored as is in the arguments.
+ *
  * @param cmd Current command being built
  * @param current Current token
  * @param ctx Context containing environment information
@@ -83,15 +87,13 @@ bool	process_word_token_case(t_command *cmd, t_token **current, t_ctx *ctx,
 		return (false);
 	if (!(*first_arg_processed) && expanded_value[0] == '\0')
 	{
-		free(expanded_value);
 		*current = (*current)->next;
 		*first_arg_processed = true;
 		if (!handle_empty_first_arg(cmd, current, ctx))
 			return (false);
 		return (true);
 	}
-	free(expanded_value);
-	if (!process_word_token(cmd, *current, ctx))
+	if (!add_expanded_arg(&ctx->arena, cmd, expanded_value))
 		return (false);
 	*first_arg_processed = true;
 	return (true);
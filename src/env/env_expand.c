@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_expand.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:32:28 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:23:39 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "env.h"
+
+/**
+ * @brief Appends the decimal form of a number to the buffer
+ *
+ * @param sb Output buffer
+ * @param n Number to format
+ * @return bool true on success, false on allocation failure
+ */
+static bool	append_number(t_strbuf *sb, int n)
+{
+	char			digits[12];
+	int				i;
+	unsigned int	u;
+
+	u = (unsigned int)n;
+	if (n < 0)
+		u = -(unsigned int)n;
+	i = 12;
+	digits[--i] = '0' + u % 10;
+	while (u >= 10)
+	{
+		u /= 10;
+		digits[--i] = '0' + u % 10;
+	}
+	if (n < 0)
+		digits[--i] = '-';
+	return (ft_strbuf_append(sb, digits + i, 12 - i));
+}
+
+/**
+ * @brief Expands the one-character parameters ($?, $!, $#, $0, $1...)
+ *
+ * Positional and unsupported special parameters expand to nothing, as
+ * does `$!` before the first background job.
+ *
+ * @param ctx Shell context
+ * @param c Character following the `$`
+ * @param sb Output buffer
+ * @return int 1 if expanded, 0 if `c` is not special, -1 on failure
+ */
+static int	expand_special(t_ctx *ctx, char c, t_strbuf *sb)
+{
+	char	*name;
+	bool	ok;
+
+	ok = true;
+	if (c == '?')
+		ok = append_number(sb, ctx->exit_status);
+	else if (c == '!' && ctx->last_bg_pid > 0)
+		ok = append_number(sb, ctx->last_bg_pid);
+	else if (c == '#')
+		ok = ft_strbuf_append(sb, "0", 1);
+	else if (c == '0')
+	{
+		name = "minishell";
+		if (ctx->argv && ctx->argv[0])
+			name = ctx->argv[0];
+		ok = ft_strbuf_append(sb, name, ft_strlen(name));
+	}
+	else if (!((c >= '1' && c <= '9') || c == '@' || c == '*' || c == '!'
+			|| c == '$' || c == '^' || c == '%'))
+		return (0);
+	if (!ok)
+		return (-1);
+	return (1);
+}
+
+/**
+ * @brief Expands `$PIPESTATUS`: the statuses of the stages of the last
+ * pipeline, separated by spaces
+ *
+ * It is computed on demand rather than stored in the environment, which
+ * would export it to every command and rebuild envp after each pipeline.
+ *
+ * @param ctx Shell context
+ * @param sb Output buffer
+ * @return bool true on success, false on allocation failure
+ */
+static bool	expand_pipestatus(t_ctx *ctx, t_strbuf *sb)
+{
+	int	i;
+
+	i = 0;
+	while (i < ctx->pipestatus.count)
+	{
+		if ((i > 0 && !ft_strbuf_append(sb, " ", 1))
+			|| !append_number(sb, ctx->pipestatus.status[i]))
+			return (false);
+		i++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Expands the variable reference starting at `str[*i]` (the `$`)
+ *
+ * The name is looked up in place, without copying it, and its value is
+ * appended directly. A `$` not followed by a name is kept as is.
+ * `PIPESTATUS` is never looked up: it is read-only and always expands to
+ * the statuses of the last pipeline.
+ *
+ * @param ctx Shell context
+ * @param str Word being expanded
+ * @param i Position of the `$`, moved past the reference
+ * @param sb Output buffer
+ * @return bool true on success, false on allocation failure
+ */
+static bool	expand_dollar(t_ctx *ctx, const char *str, size_t *i, t_strbuf *sb)
+{
+	t_env	*var;
+	size_t	len;
+	int		special;
+
+	(*i)++;
+	special = expand_special(ctx, str[*i], sb);
+	if (special != 0)
+	{
+		(*i)++;
+		return (special > 0);
+	}
+	if (!ft_isalpha(str[*i]) && str[*i] != '_')
+		return (ft_strbuf_append(sb, "$", 1));
+	len = 1;
+	while (ft_isalnum(str[*i + len]) || str[*i + len] == '_')
+		len++;
+	*i += len;
+	if (len == 10 && ft_strncmp(str + *i - len, "PIPESTATUS", 10) == 0)
+		return (expand_pipestatus(ctx, sb));
+	var = env_lookup(&ctx->env, str + *i - len, len);
+	if (!var || !var->value)
+		return (true);
+	return (ft_strbuf_append(sb, var->value, ft_strlen(var->value)));
+}
+
+/**
+ * @brief Expands the variables of a word into a buffer in a single pass
+ *
+ * Literal runs between `$` signs are copied in one block each and values
+ * are appended as they are found, so the cost is linear in the size of
+ * the result whatever the number of references.
+ *
+ * @param ctx Shell context
+ * @param str Word to expand
+ * @param sb Output buffer, appended to
+ * @return bool true on success, false on allocation failure
+ */
+bool	expand_word(t_ctx *ctx, const char *str, t_strbuf *sb)
+{
+	size_t	i;
+	size_t	start;
+
+	i = 0;
+	while (str[i])
+	{
+		start = i;
+		while (str[i] && str[i] != '$')
+			i++;
+		if (i > start && !ft_strbuf_append(sb, str + start, i - start))
+			return (false);
+		if (str[i] == '$' && !expand_dollar(ctx, str, &i, sb))
+			return (false);
+	}
+	return (true);
+}
@@ -6,82 +6,38 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/18 17:55:13 by maximart          #+#    #+#             */
-/*   Updated: 2025/03/24 11:32:12 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:37:19 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "env.h"
-#include "lexer.h"
-
-/**
- * @brief Handles expanding variables during string processing
- *
- * @param ctx Context containing environment information
- * @param str Input string
- * @param i Position in string (will be updated)
- * @param result Current result string
- * @return Updated result string
- */
-char	*handle_var_expansion(t_ctx *ctx, char *str, int *i, char *result)
-{
-	char	*var_value;
-	char	dollar[2];
-
-	dollar[0] = '$';
-	dollar[1] = '\0';
-	if (ctx->quote.in_single_quote == 1 && ctx->quote.in_double_quote == 0)
-	{
-		result = join_and_free(result, dollar);
-		(*i)++;
-		return (result);
-	}
-	var_value = expand_variable(ctx, str, i);
-	if (!var_value)
-		return (result);
-	result = join_and_free(result, var_value);
-	free(var_value);
-	return (result);
-}
-
-char	*append_text_part(int start, int i, char *result, char *str)
-{
-	char	*temp_result;
-
-	if (i > start)
-	{
-		temp_result = append_part(result, str, start, i);
-		if (!temp_result)
-			return (NULL);
-		result = temp_result;
-		return (result);
-	}
-	return (result);
-}
+#include "memory.h"
 
 /**
  * @brief Handles quotes and variables in a string
  *
+ * The word is expanded into the context's scratch buffer, which keeps its
+ * capacity from one word to the next, then copied once into the arena.
+ * Every call is counted in ctx->expansions, reported with MINISHELL_STATS.
+ *
  * @param ctx Context containing variable information
- * @param str Input string to process
- * @return Newly allocated string with processed content
+ * @param token Word token to process
+ * @return String with processed content, owned by the line arena
  */
 char	*handle_quotes_and_vars(t_ctx *ctx, t_token *token)
 {
-	char	*result;
-	char	*processed;
+	t_strbuf	*sb;
 
+	ctx->expansions++;
 	if (token->quote.in_single_quote)
-		return (ft_strdup(token->value));
+		return (token->value);
 	if (!token->value)
-		return (ft_strdup(""));
-	result = ft_strdup("");
-	if (!result)
-		return (NULL);
-	processed = process_string(ctx, token->value, result);
-	if (!processed)
-	{
-		free(result);
-		return (ft_strdup(""));
-	}
-	return (processed);
+		return (arena_strdup(&ctx->arena, ""));
+	if (ctx->quote.in_single_quote == 1 && ctx->quote.in_double_quote == 0)
+		return (arena_strdup(&ctx->arena, token->value));
+	sb = &ctx->expand_buf;
+	ft_strbuf_clear(sb);
+	if (!expand_word(ctx, token->value, sb) || sb->len == 0)
+		return (arena_strdup(&ctx->arena, ""));
+	return (arena_strndup(&ctx->arena, sb->data, sb->len));
 }
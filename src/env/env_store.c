@@ -0,0 +1,130 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:05:21 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 10:45:46 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "env.h"
+
+/**
+ * @brief Hashes a variable name (32-bit FNV-1a)
+ *
+ * @param key Name to hash, not necessarily NUL-terminated
+ * @param len Length of the name
+ * @return unsigned int Hash of the name
+ */
+unsigned int	env_hash(const char *key, size_t len)
+{
+	unsigned int	hash;
+	size_t			i;
+
+	hash = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		hash ^= (unsigned char)key[i];
+		hash *= 16777619u;
+		i++;
+	}
+	return (hash);
+}
+
+/**
+ * @brief Initializes an empty environment store
+ *
+ * @param store Store to initialize
+ */
+void	env_store_init(t_env_store *store)
+{
+	store->head = NULL;
+	store->tail = NULL;
+	store->slots = NULL;
+	store->cap = 0;
+	store->count = 0;
+	store->gen = 0;
+	store->envp = NULL;
+	store->envp_gen = 0;
+}
+
+/**
+ * @brief Creates a new environment variable node
+ *
+ * @param key Key of the environment variable
+ * @param value Value of the environment variable (may be NULL)
+ * @return t_env* New environment variable node or NULL if allocation fails
+ */
+static t_env	*create_env_node(char *key, char *value)
+{
+	t_env	*new_node;
+
+	new_node = (t_env *)malloc(sizeof(t_env));
+	if (!new_node)
+		return (NULL);
+	new_node->key_len = ft_strlen(key);
+	new_node->hash = env_hash(key, new_node->key_len);
+	new_node->key = ft_strdup(key);
+	new_node->value = NULL;
+	if (value)
+		new_node->value = ft_strdup(value);
+	if (!new_node->key || (value && !new_node->value))
+	{
+		free(new_node->key);
+		free(new_node->value);
+		free(new_node);
+		return (NULL);
+	}
+	new_node->next = NULL;
+	new_node->prev = NULL;
+	return (new_node);
+}
+
+/**
+ * @brief Adds an environment variable at the end of the store
+ *
+ * @param store Environment store
+ * @param key Key of the environment variable
+ * @param value Value of the environment variable
+ * @return int 1 if successful, 0 on error
+ * @note The key must not already be in the store
+ */
+int	add_env_var(t_env_store *store, char *key, char *value)
+{
+	t_env	*new_node;
+
+	if (!key)
+		return (0);
+	new_node = create_env_node(key, value);
+	if (!new_node)
+		return (0);
+	if (!env_table_insert(store, new_node))
+	{
+		free(new_node->key);
+		free(new_node->value);
+		free(new_node);
+		return (0);
+	}
+	return (1);
+}
+
+/**
+ * @brief Gets the value of an environment variable
+ *
+ * @param store Environment store
+ * @param key Key to look for
+ * @return Value of the variable or NULL if not found
+ */
+char	*get_env_value(t_env_store *store, char *key)
+{
+	t_env	*node;
+
+	node = env_lookup(store, key, ft_strlen(key));
+	if (!node)
+		return (NULL);
+	return (node->value);
+}
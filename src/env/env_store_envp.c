@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store_envp.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:37:41 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 10:37:41 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "env.h"
+
+/**
+ * @brief Measures the exported environment
+ *
+ * Only variables with a value are exported, as in bash.
+ *
+ * @param store Environment store
+ * @param count Set to the number of exported variables
+ * @return size_t Bytes needed for the "KEY=VALUE" strings
+ */
+static size_t	envp_measure(t_env_store *store, size_t *count)
+{
+	t_env	*node;
+	size_t	bytes;
+
+	*count = 0;
+	bytes = 0;
+	node = store->head;
+	while (node)
+	{
+		if (node->value)
+		{
+			bytes += node->key_len + ft_strlen(node->value) + 2;
+			(*count)++;
+		}
+		node = node->next;
+	}
+	return (bytes);
+}
+
+/**
+ * @brief Writes the "KEY=VALUE" strings and points the array at them
+ *
+ * @param store Environment store
+ * @param envp Array to fill, NULL-terminated
+ * @param strings Block receiving the strings
+ */
+static void	envp_fill(t_env_store *store, char **envp, char *strings)
+{
+	t_env	*node;
+	size_t	value_len;
+
+	node = store->head;
+	while (node)
+	{
+		if (node->value)
+		{
+			*envp++ = strings;
+			ft_memcpy(strings, node->key, node->key_len);
+			strings += node->key_len;
+			*strings++ = '=';
+			value_len = ft_strlen(node->value) + 1;
+			ft_memcpy(strings, node->value, value_len);
+			strings += value_len;
+		}
+		node = node->next;
+	}
+	*envp = NULL;
+}
+
+/**
+ * @brief Returns the exported environment as an `execve` array
+ *
+ * The array and its strings share a single allocation owned by the store.
+ * It is only rebuilt when the store changed since the last call, so
+ * calling this in the parent before forking leaves children nothing to do.
+ *
+ * @param store Environment store
+ * @return char** NULL-terminated environment or NULL on allocation failure
+ */
+char	**env_store_envp(t_env_store *store)
+{
+	size_t	count;
+	size_t	bytes;
+	char	**envp;
+
+	if (store->envp && store->envp_gen == store->gen)
+		return (store->envp);
+	bytes = envp_measure(store, &count);
+	envp = malloc((count + 1) * sizeof(char *) + bytes);
+	if (!envp)
+		return (NULL);
+	envp_fill(store, envp, (char *)(envp + count + 1));
+	free(store->envp);
+	store->envp = envp;
+	store->envp_gen = store->gen;
+	return (envp);
+}
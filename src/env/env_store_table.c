@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store_table.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:06:58 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 10:47:23 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "env.h"
+
+/**
+ * @brief Finds the slot holding a key, or the empty slot ending its probe
+ *
+ * @param store Environment store (its table must be allocated)
+ * @param key Key to look for
+ * @param len Length of the key
+ * @param hash Hash of the key
+ * @return size_t Slot index
+ */
+static size_t	env_probe(t_env_store *store, const char *key, size_t len,
+		unsigned int hash)
+{
+	size_t	mask;
+	size_t	i;
+	t_env	*node;
+
+	mask = store->cap - 1;
+	i = hash & mask;
+	node = store->slots[i];
+	while (node)
+	{
+		if (node->hash == hash && node->key_len == len
+			&& ft_memcmp(node->key, key, len) == 0)
+			return (i);
+		i = (i + 1) & mask;
+		node = store->slots[i];
+	}
+	return (i);
+}
+
+/**
+ * @brief Doubles the table and re-indexes every variable
+ *
+ * Walks the insertion-ordered list, so the nodes never have to be copied.
+ *
+ * @param store Environment store
+ * @return bool false on allocation failure
+ */
+static bool	env_table_grow(t_env_store *store)
+{
+	t_env	**slots;
+	t_env	*node;
+	size_t	new_cap;
+	size_t	i;
+
+	new_cap = ENV_TABLE_MIN;
+	if (store->cap)
+		new_cap = store->cap * 2;
+	slots = ft_calloc(new_cap, sizeof(t_env *));
+	if (!slots)
+		return (false);
+	free(store->slots);
+	store->slots = slots;
+	store->cap = new_cap;
+	node = store->head;
+	while (node)
+	{
+		i = node->hash & (store->cap - 1);
+		while (store->slots[i])
+			i = (i + 1) & (store->cap - 1);
+		store->slots[i] = node;
+		node = node->next;
+	}
+	return (true);
+}
+
+/**
+ * @brief Looks up a variable by name in O(1)
+ *
+ * @param store Environment store
+ * @param key Name of the variable, not necessarily NUL-terminated
+ * @param len Length of the name
+ * @return t_env* Variable node or NULL if not set
+ */
+t_env	*env_lookup(t_env_store *store, const char *key, size_t len)
+{
+	if (!store->count || !key)
+		return (NULL);
+	return (store->slots[env_probe(store, key, len, env_hash(key, len))]);
+}
+
+/**
+ * @brief Links a new node at the end of the store and indexes it
+ *
+ * @param store Environment store
+ * @param node Node to insert, with key length and hash precomputed
+ * @return bool false on allocation failure
+ */
+bool	env_table_insert(t_env_store *store, t_env *node)
+{
+	if ((store->count + 1) * 2 > store->cap && !env_table_grow(store))
+		return (false);
+	store->slots[env_probe(store, node->key, node->key_len,
+			node->hash)] = node;
+	node->prev = store->tail;
+	if (store->tail)
+		store->tail->next = node;
+	else
+		store->head = node;
+	store->tail = node;
+	store->count++;
+	store->gen++;
+	return (true);
+}
+
+/**
+ * @brief Unindexes and unlinks a node, then frees it
+ *
+ * Uses backward-shift deletion so that no tombstone is ever needed.
+ *
+ * @param store Environment store
+ * @param node Node to remove
+ */
+void	env_table_delete(t_env_store *store, t_env *node)
+{
+	size_t	i;
+	size_t	j;
+	size_t	home;
+
+	i = env_probe(store, node->key, node->key_len, node->hash);
+	j = (i + 1) & (store->cap - 1);
+	while (store->slots[j])
+	{
+		home = store->slots[j]->hash & (store->cap - 1);
+		if (((j - home) & (store->cap - 1)) >= ((j - i) & (store->cap - 1)))
+		{
+			store->slots[i] = store->slots[j];
+			i = j;
+		}
+		j = (j + 1) & (store->cap - 1);
+	}
+	store->slots[i] = NULL;
+	env_list_unlink(store, node);
+}
@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_store_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:08:35 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 10:49:00 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "env.h"
+
+/**
+ * @brief Unlinks a node from the ordered list of the store and frees it
+ *
+ * @param store Environment store
+ * @param node Node to unlink (already removed from the table)
+ */
+void	env_list_unlink(t_env_store *store, t_env *node)
+{
+	if (node->prev)
+		node->prev->next = node->next;
+	else
+		store->head = node->next;
+	if (node->next)
+		node->next->prev = node->prev;
+	else
+		store->tail = node->prev;
+	store->count--;
+	store->gen++;
+	free(node->key);
+	free(node->value);
+	free(node);
+}
+
+/**
+ * @brief Replaces the value of a variable
+ *
+ * @param store Environment store owning the variable
+ * @param node Variable to update
+ * @param value New value, ownership is taken (may be NULL)
+ */
+void	env_assign(t_env_store *store, t_env *node, char *value)
+{
+	store->gen++;
+	free(node->value);
+	node->value = value;
+}
+
+/**
+ * @brief Sets a variable, adding it at the end of the store if missing
+ *
+ * @param store Environment store
+ * @param key Key of the environment variable
+ * @param value Value to copy (may be NULL)
+ * @return int 1 if successful, 0 on error
+ */
+int	env_set(t_env_store *store, char *key, char *value)
+{
+	t_env	*node;
+	char	*new_value;
+
+	node = env_lookup(store, key, ft_strlen(key));
+	if (!node)
+		return (add_env_var(store, key, value));
+	new_value = NULL;
+	if (value)
+	{
+		new_value = ft_strdup(value);
+		if (!new_value)
+			return (0);
+	}
+	env_assign(store, node, new_value);
+	return (1);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/19 10:35:19 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:09:49 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:25:16 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,6 +20,7 @@
 void	init_file_cmd_errors(t_error_info *error_table)
 {
 	error_table[ERR_CMD_NOT_FOUND] = (t_error_info){127, "command not found"};
+	error_table[ERR_NOT_FOUND] = (t_error_info){1, "not found"};
 	error_table[ERR_NO_PERMS] = (t_error_info){126, "Permission denied"};
 	error_table[ERR_NO_FILE] = (t_error_info){127, "No such file or directory"};
 	error_table[ERR_IS_DIR] = (t_error_info){126, "Is a directory"};
@@ -63,6 +64,9 @@ void	init_validation_errors(t_error_info *error_table)
 		"filename too long"};
 	error_table[ERR_NUMERIC] = (t_error_info){2, "numeric argument required"};
 	error_table[ERR_TOO_MANY_ARGS] = (t_error_info){1, "too many arguments"};
+	error_table[ERR_INVALID_OPTION] = (t_error_info){2, "invalid option"};
+	error_table[ERR_OPTION_ARG] = (t_error_info){2,
+		"option requires an argument"};
 	error_table[ERR_UNCLOSED_QUOTE] = (t_error_info){1, "unclosed quote"};
 	error_table[ERR_TOKEN_LIST] = (t_error_info){1,
 		"failed to build token list"};
@@ -79,6 +83,8 @@ void	init_system_errors(t_error_info *error_table)
 	error_table[ERR_FD] = (t_error_info){1, "bad file descriptor"};
 	error_table[ERR_ALLOC] = (t_error_info){ENOMEM, "allocation failed"};
 	error_table[ERR_PIPE] = (t_error_info){EPIPE, "pipe processing failed"};
+	error_table[ERR_NO_JOB] = (t_error_info){127, "no such job"};
+	error_table[ERR_READONLY] = (t_error_info){1, "readonly variable"};
 }
 
 /**
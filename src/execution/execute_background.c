@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_background.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:58:09 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:58:09 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "error.h"
+#include "execute.h"
+#include "free.h"
+#include "jobs.h"
+#include "trace.h"
+
+/**
+ * @brief Runs the and-or list of a background job, then exits
+ *
+ * The job gets its own process group, so that the signals of the
+ * terminal only reach the foreground, and reads from /dev/null since the
+ * input that follows belongs to the shell.
+ *
+ * @param ctx Shell context (the job's copy)
+ * @param tokens First token of the list, which ends at `&`
+ */
+static void	run_job(t_ctx *ctx, t_token *tokens)
+{
+	int	fd;
+	int	status;
+
+	setpgid(0, 0);
+	fd = open("/dev/null", O_RDONLY);
+	if (fd != -1)
+	{
+		dup2(fd, STDIN_FILENO);
+		close(fd);
+	}
+	jobs_clear(ctx);
+	execute_and_or(ctx, tokens);
+	status = ctx->exit_status;
+	ctx_clear(ctx);
+	exit(status);
+}
+
+/**
+ * @brief Starts an and-or list in the background (`list &`)
+ *
+ * The shell does not wait for it: the job is recorded in the job table,
+ * `$!` is set to its process ID and the status of the line is 0.
+ *
+ * @param ctx Shell context
+ * @param tokens First token of the list, which ends at `&`
+ * @return bool false if the rest of the line must be abandoned
+ */
+bool	execute_background(t_ctx *ctx, t_token *tokens)
+{
+	pid_t	pid;
+	int		id;
+
+	if (prefetch_heredocs(ctx, tokens) != 0)
+		return (false);
+	pid = trace_fork(ctx);
+	if (pid == 0)
+		run_job(ctx, tokens);
+	close_prefetched_heredocs(tokens);
+	if (pid == -1)
+	{
+		error_print(NULL, "fork", "cannot start background job");
+		ctx->exit_status = 1;
+		return (true);
+	}
+	setpgid(pid, pid);
+	id = job_add(ctx, pid, tokens);
+	if (id > 0 && !ctx->reader)
+		ft_printf_fd(STDERR_FILENO, "[%d] %d\n", id, pid);
+	ctx->last_bg_pid = pid;
+	ctx->exit_status = 0;
+	return (true);
+}
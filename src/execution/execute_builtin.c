@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/02 16:45:23 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:08:24 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:19:21 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -16,13 +16,15 @@
 /**
  * @brief Executes a built-in command
  *
- * Applies redirections, executes the builtin, and restores file descriptors
+ * Applies redirections, executes the builtin, writes out what it printed
+ * through ctx->out, and restores file descriptors
  *
  * @param ctx Shell context
  * @param cmd Command to execute
+ * @param builtin Registry entry of the builtin, from builtin_lookup()
  * @return int Exit status
  */
-int	execute_builtin(t_ctx *ctx, t_command *cmd)
+int	execute_builtin(t_ctx *ctx, t_command *cmd, const t_builtin *builtin)
 {
 	int	status;
 	int	stdin_copy;
@@ -32,48 +34,8 @@ int	execute_builtin(t_ctx *ctx, t_command *cmd)
 		return (1);
 	if (!apply_redirections(cmd))
 		return (restore_original_fds(stdin_copy, stdout_copy), 1);
-	status = 1;
-	if (ft_strncmp(cmd->args[0], "cd", __INT_MAX__) == 0)
-		status = builtin_cd(ctx, cmd);
-	else if (ft_strncmp(cmd->args[0], "echo", __INT_MAX__) == 0)
-		status = builtin_echo(ctx, cmd);
-	else if (ft_strncmp(cmd->args[0], "env", __INT_MAX__) == 0)
-		status = builtin_env(ctx, cmd);
-	else if (ft_strncmp(cmd->args[0], "exit", __INT_MAX__) == 0)
-		status = builtin_exit(ctx, cmd);
-	else if (ft_strncmp(cmd->args[0], "export", __INT_MAX__) == 0)
-		status = builtin_export(ctx, cmd);
-	else if (ft_strncmp(cmd->args[0], "pwd", __INT_MAX__) == 0)
-		status = builtin_pwd();
-	else if (ft_strncmp(cmd->args[0], "unset", __INT_MAX__) == 0)
-		status = builtin_unset(ctx, cmd);
+	status = builtin->run(ctx, cmd);
+	ft_outbuf_flush(&ctx->out);
 	restore_original_fds(stdin_copy, stdout_copy);
 	return (status);
 }
-
-/**
- * @brief Checks if a command is a built-in
- *
- * @param cmd_name Command name to check
- * @return bool true if built-in, false otherwise
- */
-bool	is_builtin_command(char *cmd_name)
-{
-	if (!cmd_name)
-		return (false);
-	if (ft_strncmp(cmd_name, "exit", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "echo", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "cd", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "pwd", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "export", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "unset", __INT_MAX__) == 0)
-		return (true);
-	if (ft_strncmp(cmd_name, "env", __INT_MAX__) == 0)
-		return (true);
-	return (false);
-}
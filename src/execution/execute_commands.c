@@ -6,11 +6,13 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/02 16:44:19 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:04:04 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "builtins.h"
 #include "execute.h"
+#include "input.h"
 
 /**
  * @brief Executes special cases of commands
@@ -32,9 +34,12 @@ static bool	special_cases(t_ctx *ctx, t_command *cmd)
 /**
  * @brief Handles redirections without any command
  *
+ * Sets the exit status to 1 if a redirection fails, so that `&&` and `||`
+ * see the failure.
+ *
  * @param ctx Shell context
  * @param cmd Command structure with redirections
- * @return bool true if redirections were processed, false on error
+ * @return bool false if the heredocs could not be read, true otherwise
  */
 static bool	handle_redirections_only(t_ctx *ctx, t_command *cmd)
 {
@@ -42,19 +47,16 @@ static bool	handle_redirections_only(t_ctx *ctx, t_command *cmd)
 	int	stdout_copy;
 
 	if (!save_original_fds(&stdin_copy, &stdout_copy))
-		return (false);
+		return (ctx->exit_status = 1, true);
 	if (read_all_heredocs(ctx) != 0)
 	{
 		cleanup_heredoc_resources(ctx);
 		restore_original_fds(stdin_copy, stdout_copy);
 		return (false);
 	}
+	ctx->exit_status = 0;
 	if (!apply_redirections(cmd))
-	{
-		cleanup_heredoc_resources(ctx);
-		restore_original_fds(stdin_copy, stdout_copy);
-		return (false);
-	}
+		ctx->exit_status = 1;
 	restore_original_fds(stdin_copy, stdout_copy);
 	cleanup_heredoc_resources(ctx);
 	return (true);
@@ -65,30 +67,34 @@ static bool	handle_redirections_only(t_ctx *ctx, t_command *cmd)
  *
  * @param ctx Shell context
  * @param cmd Command to execute
+ * @return bool false if the heredocs could not be read, which aborts the
+ * rest of an and-or list
  */
-void	execute_commands(t_ctx *ctx, t_command *cmd)
+bool	execute_commands(t_ctx *ctx, t_command *cmd)
 {
+	const t_builtin	*builtin;
+
 	if (!cmd)
-		return ;
+		return (true);
 	if ((!cmd->args || !cmd->args[0]) && cmd->redirection)
-	{
-		handle_redirections_only(ctx, cmd);
-		return ;
-	}
+		return (handle_redirections_only(ctx, cmd));
 	if (!cmd->args || !cmd->args[0])
-		return ;
+		return (true);
 	if (special_cases(ctx, cmd))
-		return ;
+		return (true);
 	if (read_all_heredocs(ctx) != 0)
 	{
 		cleanup_heredoc_resources(ctx);
-		return ;
+		return (false);
 	}
-	if (cmd && !cmd->next && is_builtin_command(cmd->args[0]))
+	builtin = builtin_lookup(cmd->args[0]);
+	if (!cmd->next && builtin)
 	{
-		ctx->exit_status = execute_builtin(ctx, cmd);
-		return ;
+		ctx->exit_status = execute_builtin(ctx, cmd, builtin);
+		return (true);
 	}
+	reader_sync(ctx->reader);
 	execute_pipeline(ctx, cmd);
 	cleanup_heredoc_resources(ctx);
+	return (true);
 }
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_lastpipe.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:52 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:57:36 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "builtins.h"
+#include "error.h"
+#include "execute.h"
+
+/**
+ * @brief Tells if the last stage of a pipeline can run in the shell
+ *
+ * Only with `set -o lastpipe`, as in bash: a builtin that changes the
+ * shell's state (cd, export, exit...) then makes the change stick. By
+ * default every stage is forked, so the shell behaves as it always did.
+ *
+ * @param ctx Shell context
+ * @param cmd Last stage
+ * @return const t_builtin* Builtin to run, NULL to fork the stage
+ */
+static const t_builtin	*lastpipe_builtin(t_ctx *ctx, t_command *cmd)
+{
+	if (!ctx->lastpipe || !cmd->args || !cmd->args[0])
+		return (NULL);
+	return (builtin_lookup(cmd->args[0]));
+}
+
+/**
+ * @brief Runs the last stage of a pipeline in the shell, if it is a builtin
+ *
+ * The read end of the previous pipe is swapped in as stdin around the
+ * builtin, the way redirections are applied to a builtin run alone. Its
+ * status is recorded right away; wait_for_children() skips the stage.
+ *
+ * @param ctx Shell context
+ * @param cmd Last stage
+ * @param pipeline Pipeline execution data
+ * @return bool true if the stage ran, false if it is to be forked
+ */
+bool	execute_lastpipe(t_ctx *ctx, t_command *cmd, t_pipeline *pipeline)
+{
+	const t_builtin	*builtin;
+	int				stdin_copy;
+	int				stdout_copy;
+	int				status;
+
+	builtin = lastpipe_builtin(ctx, cmd);
+	if (!builtin || pipeline->prev_pipe_read == -1)
+		return (false);
+	status = 1;
+	if (save_original_fds(&stdin_copy, &stdout_copy))
+	{
+		if (dup2(pipeline->prev_pipe_read, STDIN_FILENO) == -1)
+			error("dup2", "pipe", ERR_FD);
+		else
+			status = execute_builtin(ctx, cmd, builtin);
+		restore_original_fds(stdin_copy, stdout_copy);
+	}
+	close(pipeline->prev_pipe_read);
+	pipeline->prev_pipe_read = -1;
+	pipeline->pids[pipeline->i] = 0;
+	if (pipeline->i < ctx->pipestatus.count)
+		ctx->pipestatus.status[pipeline->i] = status;
+	ctx->exit_status = status;
+	return (true);
+}
@@ -0,0 +1,134 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_list.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:50:26 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 14:45:02 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "commands.h"
+#include "execute.h"
+#include "free.h"
+#include "lexer.h"
+#include "trace.h"
+
+/**
+ * @brief Finds the pipeline following the current one
+ *
+ * @param tokens First token of the current pipeline
+ * @param op Set to the operator before the next pipeline
+ * @return t_token* First token of the next pipeline or NULL at the end of
+ * the and-or list
+ */
+static t_token	*next_pipeline(t_token *tokens, t_token_type *op)
+{
+	while (tokens && !token_is_separator(tokens->type))
+		tokens = tokens->next;
+	if (!tokens || tokens->type == TOK_ESP)
+		return (NULL);
+	*op = tokens->type;
+	return (tokens->next);
+}
+
+/**
+ * @brief Parses and runs one pipeline of an and-or list
+ *
+ * @param ctx Shell context
+ * @param tokens First token of the pipeline
+ * @return bool false if the rest of the list must be abandoned
+ */
+static bool	run_pipeline(t_ctx *ctx, t_token *tokens)
+{
+	bool	result;
+
+	trace_begin(ctx, "command_parse");
+	ctx->cmd = command_parse(ctx, tokens);
+	trace_end(ctx, "command_parse");
+	if (!ctx->cmd)
+		return (true);
+	result = execute_commands(ctx, ctx->cmd);
+	if (!ctx->cmd->next)
+		pipestatus_single(ctx, ctx->exit_status);
+	free_all_commands(ctx->cmd);
+	ctx->cmd = NULL;
+	return (result);
+}
+
+/**
+ * @brief Executes an and-or list (`a && b || c`)
+ *
+ * Operators have the same precedence and associate to the left: each
+ * pipeline runs only if the status of the last one that ran allows it.
+ * A pipeline is parsed, and so expanded, only once it is going to run;
+ * the ones that are skipped are never expanded nor forked, and their
+ * heredoc bodies are consumed without being stored.
+ *
+ * @param ctx Shell context
+ * @param tokens First token of the list, which ends at `&` or at the end
+ * of the line
+ * @return bool false if the rest of the line must be abandoned
+ */
+bool	execute_and_or(t_ctx *ctx, t_token *tokens)
+{
+	t_token_type	op;
+	bool			proceed;
+
+	op = TOK_NONE;
+	proceed = true;
+	while (tokens && proceed && !ctx->exit_requested)
+	{
+		if (op == TOK_NONE || (op == TOK_AND) == (ctx->exit_status == 0))
+			proceed = run_pipeline(ctx, tokens);
+		else
+			proceed = (discard_heredocs(ctx, tokens) == 0);
+		tokens = next_pipeline(tokens, &op);
+	}
+	return (proceed);
+}
+
+/**
+ * @brief Finds the end of an and-or list
+ *
+ * @param tokens First token of the list
+ * @return t_token* The `&` ending the list, or NULL if it ends the line
+ */
+static t_token	*and_or_end(t_token *tokens)
+{
+	while (tokens && tokens->type != TOK_ESP)
+		tokens = tokens->next;
+	return (tokens);
+}
+
+/**
+ * @brief Executes the lists of a line (`a & b && c`)
+ *
+ * The and-or lists ended by `&` are started in the background and the
+ * shell goes on with the next one right away.
+ *
+ * @param ctx Shell context
+ * @param tokens Validated tokens of the line
+ */
+void	execute_list(t_ctx *ctx, t_token *tokens)
+{
+	t_token	*end;
+	bool	proceed;
+
+	proceed = true;
+	while (tokens && tokens->type != TOK_EOF && proceed
+		&& !ctx->exit_requested)
+	{
+		end = and_or_end(tokens);
+		if (end)
+			proceed = execute_background(ctx, tokens);
+		else
+			proceed = execute_and_or(ctx, tokens);
+		tokens = NULL;
+		if (end)
+			tokens = end->next;
+	}
+}
@@ -6,12 +6,15 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/02 16:45:37 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 17:56:38 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:12:20 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "env.h"
 #include "execute.h"
+#include "path.h"
 #include "signals.h"
+#include "trace.h"
 
 /**
  * @brief Handles fork failures and resource cleanup
@@ -45,17 +48,21 @@ static bool	handle_fork_error(t_command *current, int pipe_fds[2],
 /**
  * @brief Initializes pipeline execution resources
  *
- * Allocates memory for process IDs and sets up initial values
+ * Allocates memory for process IDs, makes room for the status of each
+ * stage and sets up initial values
  *
+ * @param ctx Shell context
  * @param cmd Command list
  * @param pids Pointer to store process IDs array
  * @return t_pipeline_init Pipeline initialization data
  */
-static t_pipeline_init	init_pipeline(t_command *cmd, pid_t **pids)
+static t_pipeline_init	init_pipeline(t_ctx *ctx, t_command *cmd,
+		pid_t **pids)
 {
 	t_pipeline_init	init;
 
 	init.cmd_count = count_commands(cmd);
+	pipestatus_reset(ctx, init.cmd_count);
 	*pids = (pid_t *)malloc(sizeof(pid_t) * init.cmd_count);
 	if (!*pids)
 		return ((t_pipeline_init){NULL, -1, 0, 0});
@@ -94,7 +101,8 @@ static void	handle_child_process(t_ctx *ctx, t_command *current,
 /**
  * @brief Executes a single pipeline step
  *
- * Creates pipes, forks a process and handles execution
+ * Creates pipes, forks a process and handles execution, unless the step
+ * is a last builtin that runs in the shell
  *
  * @param ctx Shell context
  * @param current Current command
@@ -106,17 +114,23 @@ static bool	execute_pipeline_step(t_ctx *ctx, t_command *current,
 {
 	int	pipe_fds[2];
 
+	if (!current->next && execute_lastpipe(ctx, current, pipeline))
+		return (true);
 	if (!setup_pipeline_step(current, pipe_fds, pipeline->pids))
 		return (false);
-	pipeline->pids[pipeline->i] = fork();
-	if (pipeline->pids[pipeline->i] == -1)
+	bin_cache_prepare(ctx, current);
+	if (!spawn_command(ctx, current, pipe_fds, pipeline))
 	{
-		handle_fork_error(current, pipe_fds, pipeline->prev_pipe_read,
-			pipeline->pids);
-		return (false);
+		pipeline->pids[pipeline->i] = trace_fork(ctx);
+		if (pipeline->pids[pipeline->i] == -1)
+		{
+			handle_fork_error(current, pipe_fds, pipeline->prev_pipe_read,
+				pipeline->pids);
+			return (false);
+		}
+		if (pipeline->pids[pipeline->i] == 0)
+			handle_child_process(ctx, current, pipe_fds, pipeline);
 	}
-	if (pipeline->pids[pipeline->i] == 0)
-		handle_child_process(ctx, current, pipe_fds, pipeline);
 	cleanup_pipes(pipeline->prev_pipe_read, pipe_fds, current->next != NULL);
 	if (current->next)
 		pipeline->prev_pipe_read = pipe_fds[0];
@@ -137,10 +151,11 @@ void	execute_pipeline(t_ctx *ctx, t_command *cmd)
 	t_pipeline		pipeline;
 	t_pipeline_init	init;
 
-	init = init_pipeline(cmd, &pipeline.pids);
+	init = init_pipeline(ctx, cmd, &pipeline.pids);
 	if (!pipeline.pids)
 		return ;
 	signal(SIGINT, SIG_IGN);
+	env_store_envp(&ctx->env);
 	current = init.current;
 	pipeline.prev_pipe_read = init.prev_pipe_read;
 	pipeline.i = init.i;
@@ -151,7 +166,9 @@ void	execute_pipeline(t_ctx *ctx, t_command *cmd)
 		current = current->next;
 		pipeline.i++;
 	}
+	trace_begin(ctx, "wait_for_children");
 	wait_for_children(ctx, pipeline.pids, init.cmd_count);
+	trace_end(ctx, "wait_for_children");
 	free(pipeline.pids);
 	setup_interactive_signals();
 }
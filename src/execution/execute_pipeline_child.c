@@ -6,15 +6,18 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/05/06 15:26:04 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/07 11:46:46 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 13:38:45 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "builtins.h"
+#include "env.h"
 #include "error.h"
 #include "execute.h"
 #include "free.h"
 #include "path.h"
 #include "signals.h"
+#include "trace.h"
 
 /**
  * @brief Sets up input/output redirection for a command
@@ -39,21 +42,33 @@ static bool	setup_io_redirection(t_fds fds)
 	return (true);
 }
 
+/**
+ * @brief Releases the child's copy of the shell and exits
+ *
+ * @param ctx Shell context
+ * @param pids Process ids pointer to free
+ * @param status Exit status of the child
+ */
+static void	exit_child(t_ctx *ctx, int *pids, int status)
+{
+	ctx_clear(ctx);
+	free(pids);
+	exit(status);
+}
+
 /**
  * @brief Executes a builtin command and exits
  *
  * @param ctx Shell context
- * @param cmd Command to execute
+ * @param cmd Command to execute, whose name is a builtin
  * @param pids Process ids pointer to free
  */
 void	execute_builtin_and_exit(t_ctx *ctx, t_command *cmd, int *pids)
 {
 	int	status;
 
-	status = execute_builtin(ctx, cmd);
-	ctx_clear(ctx);
-	free(pids);
-	exit(status);
+	status = execute_builtin(ctx, cmd, builtin_lookup(cmd->args[0]));
+	exit_child(ctx, pids, status);
 }
 
 /**
@@ -70,28 +85,21 @@ void	execute_command_in_child(t_ctx *ctx, t_command *cmd, t_fds fds,
 		int *pids)
 {
 	char	*bin_path;
-	int		status;
 
 	if (!setup_io_redirection(fds) || !apply_redirections(cmd))
-	{
-		ctx_clear(ctx);
-		free(pids);
-		exit(1);
-	}
+		exit_child(ctx, pids, 1);
 	if (!cmd->args)
 		return ;
-	if (is_builtin_command(cmd->args[0]))
+	if (builtin_lookup(cmd->args[0]))
 		execute_builtin_and_exit(ctx, cmd, pids);
 	setup_child_signals();
+	trace_begin(ctx, "bin_find");
 	bin_path = bin_find(ctx, cmd->args[0]);
+	trace_end(ctx, "bin_find");
 	if (!bin_path)
-	{
-		status = ctx->exit_status;
-		ctx_clear(ctx);
-		free(pids);
-		exit(status);
-	}
-	execve(bin_path, cmd->args, ctx->envp);
+		exit_child(ctx, pids, ctx->exit_status);
+	trace_exec(ctx);
+	execve(bin_path, cmd->args, env_store_envp(&ctx->env));
 	free(bin_path);
 	exit(error(cmd->args[0], NULL, ERR_CMD_NOT_FOUND));
 }
@@ -0,0 +1,142 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_spawn.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:19:43 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:40:22 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "env.h"
+#include "execute.h"
+#include "trace.h"
+
+/**
+ * @brief Expresses the input redirections of a command as file actions
+ *
+ * Mirrors apply_input_redirection(): files are opened on stdin in order
+ * and heredoc pipes are duplicated onto it.
+ *
+ * @param fa File actions to extend
+ * @param cmd Command to spawn
+ * @return bool false if a redirection cannot be expressed
+ */
+static bool	spawn_add_inputs(posix_spawn_file_actions_t *fa, t_command *cmd)
+{
+	t_redir	*redir;
+
+	redir = cmd->redirection;
+	while (redir)
+	{
+		if (redir->type == TOK_REDIR_FROM && posix_spawn_file_actions_addopen(
+				fa, STDIN_FILENO, redir->filename, O_RDONLY, 0) != 0)
+			return (false);
+		if (redir->type == TOK_HERE_DOC_FROM && (redir->fd < 0
+				|| posix_spawn_file_actions_adddup2(fa, redir->fd,
+					STDIN_FILENO) != 0))
+			return (false);
+		redir = redir->next;
+	}
+	return (true);
+}
+
+/**
+ * @brief Expresses the output redirections of a command as file actions
+ *
+ * Mirrors apply_output_redirection().
+ *
+ * @param fa File actions to extend
+ * @param cmd Command to spawn
+ * @return bool false if a redirection cannot be expressed
+ */
+static bool	spawn_add_outputs(posix_spawn_file_actions_t *fa, t_command *cmd)
+{
+	t_redir	*redir;
+	int		flags;
+
+	redir = cmd->redirection;
+	while (redir)
+	{
+		if (redir->type == TOK_REDIR_TO || redir->type == TOK_HERE_DOC_TO)
+		{
+			flags = O_WRONLY | O_CREAT | O_APPEND;
+			if (redir->type == TOK_REDIR_TO)
+				flags = O_WRONLY | O_CREAT | O_TRUNC;
+			if (posix_spawn_file_actions_addopen(fa, STDOUT_FILENO,
+					redir->filename, flags, 0644) != 0)
+				return (false);
+		}
+		redir = redir->next;
+	}
+	return (true);
+}
+
+/**
+ * @brief Wires the pipeline ends of a stage onto stdin and stdout
+ *
+ * Mirrors setup_io_redirection(), and also closes the read end meant for
+ * the next stage, as handle_child_process() does.
+ *
+ * @param fa File actions to extend
+ * @param cmd Command to spawn
+ * @param pipe_fds Pipe towards the next stage, if there is one
+ * @param prev_read Read end of the previous pipe, or -1
+ * @return bool false on error
+ */
+static bool	spawn_add_pipes(posix_spawn_file_actions_t *fa, t_command *cmd,
+		int pipe_fds[2], int prev_read)
+{
+	if (prev_read != -1 && (posix_spawn_file_actions_adddup2(fa, prev_read,
+				STDIN_FILENO) != 0
+			|| posix_spawn_file_actions_addclose(fa, prev_read) != 0))
+		return (false);
+	if (!cmd->next)
+		return (true);
+	return (posix_spawn_file_actions_adddup2(fa, pipe_fds[1],
+			STDOUT_FILENO) == 0
+		&& posix_spawn_file_actions_addclose(fa, pipe_fds[1]) == 0
+		&& posix_spawn_file_actions_addclose(fa, pipe_fds[0]) == 0);
+}
+
+/**
+ * @brief Launches an external pipeline stage with posix_spawn()
+ *
+ * The child never runs shell code: pipes and redirections are replayed as
+ * file actions and the C library can use vfork-style cloning, so launch
+ * cost no longer scales with the shell's memory. Any failure, including a
+ * redirection that cannot be opened, makes the caller fall back to fork(),
+ * which reports the error exactly as before.
+ *
+ * @param ctx Shell context
+ * @param cmd Command to launch
+ * @param pipe_fds Pipe towards the next stage, if there is one
+ * @param pipeline Pipeline execution data, receives the pid
+ * @return bool true if the command was spawned
+ */
+bool	spawn_command(t_ctx *ctx, t_command *cmd, int pipe_fds[2],
+		t_pipeline *pipeline)
+{
+	posix_spawn_file_actions_t	fa;
+	posix_spawnattr_t			attr;
+	char						*path;
+	bool						ok;
+
+	path = spawn_path(ctx, cmd);
+	if (!path || !spawn_attr_init(&attr))
+		return (false);
+	if (posix_spawn_file_actions_init(&fa) != 0)
+		return (posix_spawnattr_destroy(&attr), false);
+	ok = spawn_add_pipes(&fa, cmd, pipe_fds, pipeline->prev_pipe_read)
+		&& spawn_add_inputs(&fa, cmd) && spawn_add_outputs(&fa, cmd);
+	trace_begin(ctx, "posix_spawn");
+	ok = ok && posix_spawn(&pipeline->pids[pipeline->i], path, &fa, &attr,
+			cmd->args, env_store_envp(&ctx->env)) == 0;
+	trace_end(ctx, "posix_spawn");
+	posix_spawn_file_actions_destroy(&fa);
+	posix_spawnattr_destroy(&attr);
+	return (ok);
+}
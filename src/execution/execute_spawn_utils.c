@@ -0,0 +1,70 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_spawn_utils.c                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:21:20 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:24:12 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "builtins.h"
+#include "execute.h"
+#include "path.h"
+
+/**
+ * @brief Returns the program a command can be spawned from
+ *
+ * Builtins, commands without a name and commands missing from the command
+ * cache are left to the fork() path. Explicit paths are passed as is: if
+ * they cannot be executed, posix_spawn() fails and the fork() path prints
+ * the usual error.
+ *
+ * @param ctx Shell context
+ * @param cmd Command to launch
+ * @return char* Program path or NULL if the command must be forked
+ */
+char	*spawn_path(t_ctx *ctx, t_command *cmd)
+{
+	t_bin_entry	*entry;
+
+	if (ctx->no_spawn || !cmd->args || !cmd->args[0]
+		|| builtin_lookup(cmd->args[0]))
+		return (NULL);
+	if (is_path(cmd->args[0]))
+		return (cmd->args[0]);
+	entry = bin_cache_get(&ctx->bin_cache, cmd->args[0]);
+	if (!entry)
+		return (NULL);
+	return (entry->path);
+}
+
+/**
+ * @brief Prepares spawn attributes matching setup_child_signals()
+ *
+ * The shell ignores SIGINT while a pipeline runs, and ignored signals
+ * survive execve(), so they are reset to their default action.
+ *
+ * @param attr Attributes to initialize
+ * @return bool false on error
+ */
+bool	spawn_attr_init(posix_spawnattr_t *attr)
+{
+	sigset_t	sigdef;
+
+	if (posix_spawnattr_init(attr) != 0)
+		return (false);
+	sigemptyset(&sigdef);
+	sigaddset(&sigdef, SIGINT);
+	sigaddset(&sigdef, SIGQUIT);
+	if (posix_spawnattr_setsigdefault(attr, &sigdef) != 0
+		|| posix_spawnattr_setflags(attr, POSIX_SPAWN_SETSIGDEF) != 0)
+	{
+		posix_spawnattr_destroy(attr);
+		return (false);
+	}
+	return (true);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execute_wait.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:38:34 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:13:57 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "execute.h"
+#include "jobs.h"
+
+/**
+ * @brief Finds the stage of the pipeline a process belongs to
+ *
+ * @param pids Process IDs of the stages
+ * @param cmd_count Number of stages
+ * @param pid Process that was reaped
+ * @return int Index of the stage, or -1 if it is not one of them
+ */
+static int	stage_index(pid_t *pids, int cmd_count, pid_t pid)
+{
+	int	i;
+
+	i = 0;
+	while (i < cmd_count && pids[i] != pid)
+		i++;
+	if (i == cmd_count)
+		return (-1);
+	return (i);
+}
+
+/**
+ * @brief Counts the stages that run in a child process
+ *
+ * @param pids Process IDs of the stages, 0 for a stage run in the shell
+ * @param cmd_count Number of stages
+ * @return int Number of children to wait for
+ */
+static int	count_children(pid_t *pids, int cmd_count)
+{
+	int	count;
+	int	i;
+
+	count = 0;
+	i = 0;
+	while (i < cmd_count)
+	{
+		if (pids[i] > 0)
+			count++;
+		i++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Records the status of a stage that has just exited
+ *
+ * The status of the last stage becomes the one of the pipeline.
+ *
+ * @param ctx Shell context
+ * @param i Index of the stage
+ * @param wstatus Status returned by waitpid()
+ * @param last Whether it is the last stage
+ */
+static void	record_stage(t_ctx *ctx, int i, int wstatus, bool last)
+{
+	int	status;
+
+	status = 0;
+	if (WIFEXITED(wstatus))
+		status = WEXITSTATUS(wstatus);
+	else if (WIFSIGNALED(wstatus))
+		status = 128 + WTERMSIG(wstatus);
+	if (i < ctx->pipestatus.count)
+		ctx->pipestatus.status[i] = status;
+	if (!last)
+		return ;
+	ctx->exit_status = status;
+	if (WIFSIGNALED(wstatus) && WTERMSIG(wstatus) == SIGQUIT)
+		write(STDOUT_FILENO, "Quit (core dumped)\n", 19);
+}
+
+/**
+ * @brief Waits for child processes to finish and handles exit status
+ *
+ * Children are reaped in the order they exit, so a stage that is done
+ * never waits as a zombie for the ones before it. The status of every
+ * stage is kept in ctx->pipestatus; background jobs that end meanwhile
+ * are recorded in the job table. A stage without a process (pid 0) ran in
+ * the shell and already recorded its status.
+ *
+ * @param ctx Shell context
+ * @param pids Array of process IDs
+ * @param cmd_count Number of commands
+ */
+void	wait_for_children(t_ctx *ctx, pid_t *pids, int cmd_count)
+{
+	int		left;
+	int		wstatus;
+	int		i;
+	pid_t	pid;
+
+	left = count_children(pids, cmd_count);
+	while (left > 0)
+	{
+		pid = waitpid(-1, &wstatus, 0);
+		if (pid == -1 && errno != EINTR)
+			break ;
+		i = -1;
+		if (pid > 0)
+			i = stage_index(pids, cmd_count, pid);
+		if (i >= 0)
+		{
+			record_stage(ctx, i, wstatus, i == cmd_count - 1);
+			left--;
+		}
+		else if (pid > 0)
+			jobs_record(ctx, pid, wstatus);
+	}
+	pipestatus_pipefail(ctx);
+}
@@ -6,14 +6,16 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/17 15:30:10 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 17:56:38 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:25:38 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "error.h"
 #include "execute.h"
 #include "globals.h"
+#include "lexer.h"
 #include "signals.h"
+#include "trace.h"
 
 static void	restore_shell_state(void)
 {
@@ -23,21 +25,32 @@ static void	restore_shell_state(void)
 	g_signal_status = 0;
 }
 
-static int	create_heredoc(t_ctx *ctx, char *delimiter)
+/**
+ * @brief Reads one heredoc body into a fresh heredoc file
+ *
+ * The body is fully written before any command runs, then the file is
+ * rewound so that the command reads it from the start.
+ *
+ * @param ctx Context containing environment information
+ * @param delimiter Heredoc delimiter
+ * @return int File descriptor positioned at the start, or -1 on error
+ */
+int	create_heredoc(t_ctx *ctx, char *delimiter)
 {
-	int	pipe_fds[2];
-	int	read_fd;
+	int	fd;
 	int	result;
 
 	g_signal_status = 0;
-	if (pipe(pipe_fds) == -1)
-		return (error(NULL, "heredoc", ERR_PIPE));
+	fd = heredoc_open();
+	if (fd == -1)
+		return (-1);
 	setup_heredoc_signals();
-	result = read_heredoc_content(pipe_fds, delimiter, ctx);
-	close(pipe_fds[1]);
+	result = read_heredoc_content(fd, delimiter, ctx);
+	if (result == 0 && !heredoc_rewind(fd))
+		result = -1;
 	if (result == -1 || is_heredoc_interrupted())
 	{
-		close(pipe_fds[0]);
+		close(fd);
 		if (is_heredoc_interrupted())
 		{
 			ctx->exit_status = 130;
@@ -46,14 +59,15 @@ static int	create_heredoc(t_ctx *ctx, char *delimiter)
 		restore_shell_state();
 		return (-1);
 	}
-	read_fd = pipe_fds[0];
 	restore_shell_state();
-	return (read_fd);
+	return (fd);
 }
 
 /**
  * @brief Reads heredoc content for all commands in a pipeline
  *
+ * Bodies already read ahead for a background job are left as they are.
+ *
  * @param ctx Context containing environment information
  * @return int 0 on success, -1 on error
  */
@@ -61,24 +75,74 @@ int	read_all_heredocs(t_ctx *ctx)
 {
 	t_command	*current;
 	t_redir		*redir;
-	int			heredoc_fd;
+	int			result;
 
+	trace_begin(ctx, "read_all_heredocs");
+	result = 0;
 	current = ctx->cmd;
-	while (current)
+	while (current && result == 0)
 	{
 		redir = current->redirection;
-		while (redir)
+		while (redir && result == 0)
 		{
-			if (redir->type == TOK_HERE_DOC_FROM)
-			{
-				heredoc_fd = create_heredoc(ctx, redir->filename);
-				if (heredoc_fd == -1)
-					return (-1);
-				redir->fd = heredoc_fd;
-			}
+			if (redir->type == TOK_HERE_DOC_FROM && redir->fd == -1)
+				redir->fd = create_heredoc(ctx, redir->filename);
+			if (redir->type == TOK_HERE_DOC_FROM && redir->fd == -1)
+				result = -1;
 			redir = redir->next;
 		}
 		current = current->next;
 	}
+	trace_end(ctx, "read_all_heredocs");
+	return (result);
+}
+
+/**
+ * @brief Consumes a heredoc body without storing or expanding it
+ *
+ * Used for the pipelines of an and-or list that are not run: their body
+ * still follows in the input and must not be read as commands.
+ *
+ * @param ctx Context containing environment information
+ * @param delimiter Heredoc delimiter
+ * @return int 0 on success, -1 on error or interruption
+ */
+static int	discard_heredoc(t_ctx *ctx, char *delimiter)
+{
+	int	result;
+
+	g_signal_status = 0;
+	setup_heredoc_signals();
+	result = read_heredoc_content(-1, delimiter, ctx);
+	if (is_heredoc_interrupted())
+	{
+		ctx->exit_status = 130;
+		result = -1;
+	}
+	restore_shell_state();
+	return (result);
+}
+
+/**
+ * @brief Consumes the heredoc bodies of a pipeline that is not run
+ *
+ * @param ctx Context containing environment information
+ * @param tokens First token of the pipeline, which ends at `&&`, `||`,
+ * `&` or at the end of the line
+ * @return int 0 on success, -1 on error or interruption
+ * @note Bodies read ahead for a background job are only closed
+ */
+int	discard_heredocs(t_ctx *ctx, t_token *tokens)
+{
+	while (tokens && !token_is_separator(tokens->type))
+	{
+		if (tokens->type == TOK_HERE_DOC_FROM && tokens->fd >= 0)
+			close(tokens->fd);
+		else if (tokens->type == TOK_HERE_DOC_FROM && tokens->next
+			&& tokens->next->type == TOK_WORD
+			&& discard_heredoc(ctx, tokens->next->value) != 0)
+			return (-1);
+		tokens = tokens->next;
+	}
 	return (0);
 }
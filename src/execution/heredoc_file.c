@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_file.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 12:45:24 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:39:49 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#define _GNU_SOURCE
+#include "error.h"
+#include "execute.h"
+#include <sys/mman.h> // memfd_create
+
+#ifdef MFD_CLOEXEC
+
+/**
+ * @brief Creates an anonymous in-memory file
+ *
+ * @return int File descriptor or -1 on failure
+ */
+static int	heredoc_memfd(void)
+{
+	return (memfd_create("minishell-heredoc", MFD_CLOEXEC));
+}
+
+#else
+
+static int	heredoc_memfd(void)
+{
+	return (-1);
+}
+
+#endif
+
+/**
+ * @brief Creates the file holding a heredoc body
+ *
+ * An anonymous memfd is used when the system has one, an unlinked file in
+ * /tmp otherwise. Unlike a pipe, the file never blocks the writer, so a
+ * body of any size can be stored before the command that reads it starts.
+ *
+ * @return int Read-write file descriptor or -1 on failure
+ */
+int	heredoc_open(void)
+{
+	char	path[32];
+	int		fd;
+
+	fd = heredoc_memfd();
+	if (fd != -1)
+		return (fd);
+	ft_strlcpy(path, "/tmp/minishell-heredoc-XXXXXX", sizeof(path));
+	fd = mkstemp(path);
+	if (fd == -1)
+	{
+		error(NULL, "heredoc", ERR_IO);
+		return (-1);
+	}
+	unlink(path);
+	return (fd);
+}
+
+/**
+ * @brief Writes out and empties the heredoc buffer
+ *
+ * A write interrupted by a signal (SIGCHLD from a job, for one) is retried.
+ *
+ * @param fd Heredoc file, or -1 when the body is discarded
+ * @param sb Buffered heredoc lines
+ * @return bool true on success, false on write error
+ */
+bool	heredoc_flush(int fd, t_strbuf *sb)
+{
+	size_t	done;
+	ssize_t	written;
+	bool	ok;
+
+	done = 0;
+	while (fd >= 0 && done < sb->len)
+	{
+		written = write(fd, sb->data + done, sb->len - done);
+		if (written == 0 || (written < 0 && errno != EINTR))
+			break ;
+		if (written > 0)
+			done += written;
+	}
+	ok = (fd < 0 || done == sb->len);
+	ft_strbuf_clear(sb);
+	if (!ok)
+		error(NULL, "heredoc", ERR_IO);
+	return (ok);
+}
+
+/**
+ * @brief Moves back to the start of a fully written heredoc file
+ *
+ * @param fd Heredoc file
+ * @return bool true on success, false on error
+ */
+bool	heredoc_rewind(int fd)
+{
+	if (lseek(fd, 0, SEEK_SET) == -1)
+	{
+		error(NULL, "heredoc", ERR_IO);
+		return (false);
+	}
+	return (true);
+}
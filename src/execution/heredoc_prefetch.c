@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_prefetch.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:59:46 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:59:46 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "execute.h"
+
+/**
+ * @brief Reads the heredoc bodies of an and-or list run in the background
+ *
+ * A background job must not read the input that follows the line, which
+ * belongs to the shell, so the shell reads the bodies before forking and
+ * the job inherits the open files through the heredoc tokens.
+ *
+ * @param ctx Context containing environment information
+ * @param tokens First token of the list, which ends at `&`
+ * @return int 0 on success, -1 on error or interruption
+ */
+int	prefetch_heredocs(t_ctx *ctx, t_token *tokens)
+{
+	t_token	*current;
+
+	current = tokens;
+	while (current && current->type != TOK_ESP)
+	{
+		if (current->type == TOK_HERE_DOC_FROM && current->next
+			&& current->next->type == TOK_WORD)
+		{
+			current->fd = create_heredoc(ctx, current->next->value);
+			if (current->fd == -1)
+			{
+				close_prefetched_heredocs(tokens);
+				return (-1);
+			}
+		}
+		current = current->next;
+	}
+	return (0);
+}
+
+/**
+ * @brief Closes the shell's copy of the bodies read by prefetch_heredocs()
+ *
+ * @param tokens First token of the list, which ends at `&`
+ */
+void	close_prefetched_heredocs(t_token *tokens)
+{
+	while (tokens && tokens->type != TOK_ESP)
+	{
+		if (tokens->type == TOK_HERE_DOC_FROM && tokens->fd >= 0)
+		{
+			close(tokens->fd);
+			tokens->fd = -1;
+		}
+		tokens = tokens->next;
+	}
+}
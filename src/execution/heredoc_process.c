@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/24 12:10:14 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:19:06 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 12:50:15 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -14,45 +14,70 @@
 #include "execute.h"
 #include "globals.h"
 
+/**
+ * @brief Expands one heredoc line and appends it to the heredoc buffer
+ *
+ * The line is walked once by expand_word(), so substituted values are
+ * never rescanned. The buffer is written out in large blocks, once it
+ * holds HEREDOC_FLUSH bytes. A negative fd discards the line (skipped
+ * heredoc).
+ *
+ * @param fd Heredoc file, or -1
+ * @param line Line read from the input, freed here
+ * @param ctx Shell context
+ * @return int 0 on success, -1 on failure
+ */
 static int	process_heredoc_line(int fd, char *line, t_ctx *ctx)
 {
-	char	*expanded_line;
+	t_strbuf	*sb;
+	bool		ok;
 
-	expanded_line = expand_variables_in_line(ctx, line);
+	if (fd < 0)
+	{
+		free(line);
+		return (0);
+	}
+	sb = &ctx->expand_buf;
+	ok = expand_word(ctx, line, sb) && ft_strbuf_append(sb, "\n", 1);
 	free(line);
-	if (!expanded_line)
+	if (!ok)
+		return (-1);
+	if (sb->len >= HEREDOC_FLUSH && !heredoc_flush(fd, sb))
 		return (-1);
-	write(fd, expanded_line, ft_strlen(expanded_line));
-	write(fd, "\n", 1);
-	free(expanded_line);
 	return (0);
 }
 
-int	read_heredoc_content(int *pipe_fds, char *delimiter, t_ctx *ctx)
+/**
+ * @brief Reads a heredoc body up to its delimiter into a file
+ *
+ * @param fd Heredoc file, or -1 to discard the body
+ * @param delimiter Heredoc delimiter
+ * @param ctx Shell context
+ * @return int 0 on success, -1 on error or interruption
+ */
+int	read_heredoc_content(int fd, char *delimiter, t_ctx *ctx)
 {
 	char	*line;
 	int		status;
 
 	g_signal_status = 0;
 	rl_event_hook = interrupt_check_hook;
-	while (1)
+	ft_strbuf_clear(&ctx->expand_buf);
+	status = 0;
+	while (status == 0)
 	{
 		if (is_heredoc_interrupted())
 			return (-1);
-		status = read_heredoc_line(delimiter, &line);
+		status = read_heredoc_line(ctx, delimiter, &line);
 		if (is_heredoc_interrupted())
 		{
-			if (line)
-				free(line);
+			free(line);
 			return (-1);
 		}
-		if (status != 0)
-		{
-			if (status < 0)
-				return (-1);
-			return (0);
-		}
-		if (process_heredoc_line(pipe_fds[1], line, ctx) == -1)
+		if (status == 0 && process_heredoc_line(fd, line, ctx) == -1)
 			return (-1);
 	}
+	if (status < 0 || !heredoc_flush(fd, &ctx->expand_buf))
+		return (-1);
+	return (0);
 }
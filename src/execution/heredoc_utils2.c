@@ -6,11 +6,12 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/08 13:59:38 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:21:42 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 09:26:33 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "globals.h"
+#include "input.h"
 #include "minishell.h" // required bc globals.h does not include minishell.h
 
 /**
@@ -32,6 +33,22 @@ static void	display_heredoc_eof_warning(void)
 		warning_part2, warning_part3);
 }
 
+/**
+ * @brief Reads one raw heredoc line, from the script reader when running
+ * non-interactively, from readline otherwise
+ *
+ * @param ctx Shell context
+ * @return char* Newly allocated line or NULL on end of input
+ */
+static char	*read_raw_heredoc_line(t_ctx *ctx)
+{
+	if (ctx->reader)
+		return (reader_next_line(ctx->reader));
+	rl_catch_signals = 0;
+	rl_catch_sigwinch = 0;
+	return (readline("> "));
+}
+
 /**
  * Reads a line from standard input for heredoc
  *
@@ -39,21 +56,20 @@ static void	display_heredoc_eof_warning(void)
  * the delimiter or if the user has pressed Ctrl+D. It returns different values
  * depending on the result.
  *
+ * @param ctx Shell context
  * @param delimiter The heredoc delimiter string
  * @param line Pointer to store the read line
  * @return 1 if delimiter matched or EOF encountered, 0 if normal line, -1 on
  * error
  */
-int	read_heredoc_line(char *delimiter, char **line)
+int	read_heredoc_line(t_ctx *ctx, char *delimiter, char **line)
 {
 	int	delimiter_len;
 
 	if (g_signal_status == 130)
 		return (-1);
 	delimiter_len = ft_strlen(delimiter);
-	rl_catch_signals = 0;
-	rl_catch_sigwinch = 0;
-	*line = readline("> ");
+	*line = read_raw_heredoc_line(ctx);
 	if (!(*line) || g_signal_status == 130)
 	{
 		if (*line && g_signal_status == 130)
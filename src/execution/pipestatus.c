@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipestatus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:36:57 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 14:36:57 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "execute.h"
+
+/**
+ * @brief Makes room for the statuses of a pipeline of `count` stages
+ *
+ * The array is kept from one pipeline to the next and only grows.
+ *
+ * @param ctx Shell context
+ * @param count Number of stages
+ * @return bool false if allocation fails, the array is then left empty
+ */
+bool	pipestatus_reset(t_ctx *ctx, int count)
+{
+	int	*status;
+	int	cap;
+
+	ctx->pipestatus.count = 0;
+	if (count > ctx->pipestatus.cap)
+	{
+		cap = ctx->pipestatus.cap;
+		if (cap == 0)
+			cap = PIPESTATUS_MIN;
+		while (cap < count)
+			cap *= 2;
+		status = malloc(cap * sizeof(int));
+		if (!status)
+			return (false);
+		free(ctx->pipestatus.status);
+		ctx->pipestatus.status = status;
+		ctx->pipestatus.cap = cap;
+	}
+	ft_memset(ctx->pipestatus.status, 0, count * sizeof(int));
+	ctx->pipestatus.count = count;
+	return (true);
+}
+
+/**
+ * @brief Records the status of a command that was not a pipeline
+ *
+ * @param ctx Shell context
+ * @param status Exit status of the command
+ */
+void	pipestatus_single(t_ctx *ctx, int status)
+{
+	if (pipestatus_reset(ctx, 1))
+		ctx->pipestatus.status[0] = status;
+}
+
+/**
+ * @brief Applies `pipefail` to the status of the pipeline that just ended
+ *
+ * With `pipefail`, the status of a pipeline is the one of its last stage
+ * that failed, or 0 if they all succeeded. Otherwise it stays the one of
+ * its last stage.
+ *
+ * @param ctx Shell context
+ */
+void	pipestatus_pipefail(t_ctx *ctx)
+{
+	int	i;
+
+	if (!ctx->pipefail)
+		return ;
+	i = ctx->pipestatus.count;
+	while (i-- > 0)
+	{
+		if (ctx->pipestatus.status[i] != 0)
+		{
+			ctx->exit_status = ctx->pipestatus.status[i];
+			return ;
+		}
+	}
+}
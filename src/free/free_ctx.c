@@ -6,12 +6,15 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/12 18:24:28 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:22:57 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 15:52:56 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "free.h"
-#include "lexer.h" // for free_all_token
+#include "jobs.h"
+#include "memory.h"
+#include "path.h"
+#include "trace.h"
 
 /**
  * @brief Closes any open file descriptors in the context
@@ -33,27 +36,28 @@ static void	close_file_descriptors(t_ctx *ctx)
 }
 
 /**
- * @brief Frees environment, tokens and command structures from context
+ * @brief Frees environment, command resources and the line arena from context
  *
  * @param ctx Context to clean up
  */
 static void	free_structures(t_ctx *ctx)
 {
-	if (ctx->tokens)
-	{
-		free_all_token(ctx->tokens);
-		ctx->tokens = NULL;
-	}
+	ctx->tokens = NULL;
 	if (ctx->cmd)
 	{
 		free_all_commands(ctx->cmd);
 		ctx->cmd = NULL;
 	}
-	if (ctx->env_list)
-	{
-		free_env_list(ctx->env_list);
-		ctx->env_list = NULL;
-	}
+	free_env_list(&ctx->env);
+	bin_cache_clear(&ctx->bin_cache);
+	path_vec_clear(&ctx->path_vec);
+	path_watch_close(&ctx->path_vec);
+	creds_clear(&ctx->creds);
+	arena_destroy(&ctx->arena);
+	ft_strbuf_free(&ctx->expand_buf);
+	jobs_clear(ctx);
+	free(ctx->pipestatus.status);
+	trace_close(ctx);
 }
 
 /**
@@ -6,23 +6,24 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/10 14:42:24 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:23:38 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:53:51 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "init.h"
+#include "env.h"
+#include "free.h"
 
 /**
- * @brief Frees environment variable list
+ * @brief Frees every environment variable and the store table
  *
- * @param env_list List to free
+ * @param store Store to free
  */
-void	free_env_list(t_env *env_list)
+void	free_env_list(t_env_store *store)
 {
 	t_env	*current;
 	t_env	*next;
 
-	current = env_list;
+	current = store->head;
 	while (current)
 	{
 		next = current->next;
@@ -32,16 +33,19 @@ void	free_env_list(t_env *env_list)
 		free(current);
 		current = next;
 	}
+	free(store->slots);
+	free(store->envp);
+	env_store_init(store);
 }
 
 /**
  * @brief Parses an environment variable string
  *
  * @param env_str Environment variable string (KEY=VALUE)
- * @param env_list Pointer to the environment list
+ * @param store Environment store
  * @return 1 if successful, 0 on error
  */
-int	parse_env_var(char *env_str, t_env **env_list)
+int	parse_env_var(char *env_str, t_env_store *store)
 {
 	char	*equals_pos;
 	char	*key;
@@ -51,14 +55,14 @@ int	parse_env_var(char *env_str, t_env **env_list)
 
 	equals_pos = ft_strchr(env_str, '=');
 	if (!equals_pos)
-		return (add_env_var(env_list, env_str, NULL));
+		return (env_set(store, env_str, NULL));
 	key_len = (int)(equals_pos - env_str);
 	key = (char *)malloc((size_t)(key_len + 1));
 	if (!key)
 		return (0);
 	ft_strlcpy(key, env_str, (size_t)(key_len + 1));
 	value = equals_pos + 1;
-	result = add_env_var(env_list, key, value);
+	result = env_set(store, key, value);
 	free(key);
 	return (result);
 }
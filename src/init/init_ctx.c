@@ -6,12 +6,17 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/05 10:56:03 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:24:11 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:15:23 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
+#include "env.h"
 #include "error.h"
 #include "free.h"
+#include "jobs.h"
+#include "memory.h"
+#include "path.h"
+#include "trace.h"
 
 /**
  * @brief Initializes the environment in the context
@@ -26,7 +31,7 @@ static void	init_ctx_envp(t_ctx *ctx, char **envp)
 	i = 0;
 	while (envp[i])
 	{
-		if (!parse_env_var(envp[i], &ctx->env_list))
+		if (!parse_env_var(envp[i], &ctx->env))
 		{
 			ctx_clear(ctx);
 			return ;
@@ -35,6 +40,31 @@ static void	init_ctx_envp(t_ctx *ctx, char **envp)
 	}
 }
 
+/**
+ * @brief Initializes the per-line buffers and the runtime options
+ *
+ * @param ctx Context being initialized
+ */
+static void	init_ctx_runtime(t_ctx *ctx)
+{
+	arena_init(&ctx->arena);
+	ctx->expansions = 0;
+	ft_strbuf_init(&ctx->expand_buf);
+	ft_outbuf_init(&ctx->out, STDOUT_FILENO);
+	ctx->show_stats = (getenv("MINISHELL_STATS") != NULL);
+	ctx->no_spawn = (getenv("MINISHELL_NO_SPAWN") != NULL);
+	if (getenv("MINISHELL_WATCH_PATH"))
+		path_watch_open(&ctx->path_vec);
+	ctx->job_count = 0;
+	job_sigchld_init();
+	ctx->last_bg_pid = 0;
+	ctx->pipestatus = (t_pipestatus){NULL, 0, 0};
+	ctx->pipefail = false;
+	ctx->lastpipe = false;
+	creds_init(&ctx->creds);
+	trace_init(ctx);
+}
+
 /**
  * @brief Initializes the context
  *
@@ -50,7 +80,9 @@ t_ctx	*init_ctx(int argc, char **argv, char **envp)
 	ctx = malloc(sizeof(t_ctx));
 	if (!ctx)
 		exit(error(NULL, "malloc", ERR_ALLOC));
-	ctx->env_list = NULL;
+	env_store_init(&ctx->env);
+	bin_cache_init(&ctx->bin_cache);
+	ctx->path_vec = (t_path_vec){NULL, 0, false, false, 0, 0, -1};
 	init_ctx_envp(ctx, envp);
 	ctx->exit_requested = false;
 	ctx->exit_status = 0;
@@ -63,71 +95,7 @@ t_ctx	*init_ctx(int argc, char **argv, char **envp)
 	ctx->envp = envp;
 	ctx->fd_file_in = -1;
 	ctx->fd_file_out = -1;
+	ctx->reader = NULL;
+	init_ctx_runtime(ctx);
 	return (ctx);
 }
-
-/**
- * @brief Creates a new environment variable node
- *
- * @param key Key of the environment variable
- * @param value Value of the environment variable
- * @return t_env* New environment variable node or NULL if allocation fails
- */
-static t_env	*create_env_node(char *key, char *value)
-{
-	t_env	*new_node;
-
-	new_node = (t_env *)malloc(sizeof(t_env));
-	if (!new_node)
-		return (NULL);
-	new_node->key = ft_strdup(key);
-	if (!new_node->key)
-	{
-		free(new_node);
-		return (NULL);
-	}
-	if (value)
-	{
-		new_node->value = ft_strdup(value);
-		if (!new_node->value)
-		{
-			free(new_node->key);
-			free(new_node);
-			return (NULL);
-		}
-	}
-	else
-		new_node->value = NULL;
-	new_node->next = NULL;
-	return (new_node);
-}
-
-/**
- * @brief Adds an environment variable to the list
- *
- * @param env_list Pointer to the list head
- * @param key Key of the environment variable
- * @param value Value of the environment variable
- * @return int 1 if successful, 0 on error
- */
-int	add_env_var(t_env **env_list, char *key, char *value)
-{
-	t_env	*new_node;
-	t_env	*current;
-
-	if (!key)
-		return (0);
-	new_node = create_env_node(key, value);
-	if (!new_node)
-		return (0);
-	if (!*env_list)
-	{
-		*env_list = new_node;
-		return (1);
-	}
-	current = *env_list;
-	while (current->next)
-		current = current->next;
-	current->next = new_node;
-	return (1);
-}
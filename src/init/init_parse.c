@@ -6,31 +6,33 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/05 19:14:26 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 15:06:10 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:30:29 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "lexer.h" // for t_parse
-#include "minishell.h"
+#include "memory.h"
 
 /**
  * @brief Creates and initializes a new token
  *
+ * @param arena Line arena owning the token
  * @param type Token type enumeration
- * @param value String value of the token
+ * @param value String value of the token, must outlive the line
  * @return New token pointer or NULL if allocation fails
- * @note Caller must free the returned token
+ * @note The token is owned by the arena and must not be freed
  */
-t_token	*create_token(t_token_type type, char *value)
+t_token	*create_token(t_arena *arena, t_token_type type, char *value)
 {
 	t_token	*token;
 
-	token = malloc(sizeof(t_token));
+	token = arena_alloc(arena, sizeof(t_token));
 	if (!token)
 		return (NULL);
 	token->type = type;
 	token->next = NULL;
 	token->value = value;
+	token->fd = -1;
 	token->quote.in_double_quote = false;
 	token->quote.in_single_quote = false;
 	return (token);
@@ -53,6 +55,7 @@ t_command	*create_command(void)
 	cmd->next = NULL;
 	cmd->args = NULL;
 	cmd->arg_count = 0;
+	cmd->arg_cap = 0;
 	return (cmd);
 }
 
@@ -0,0 +1,69 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_process.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:16:51 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:46:50 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "checker.h"
+#include "commands.h"
+#include "execute.h"
+#include "free.h"
+#include "input.h"
+#include "lexer.h"
+#include "memory.h"
+#include "signals.h"
+#include "trace.h"
+
+/**
+ * @brief Processes user input and executes commands
+ *
+ * Handles tokenization and validation, then runs the line as an and-or
+ * list whose pipelines are parsed one at a time
+ *
+ * @param ctx Shell context
+ * @param input User input string
+ */
+void	process_user_input(t_ctx *ctx, char *input)
+{
+	bool	valid;
+
+	trace_begin(ctx, "tokenize");
+	ctx->tokens = tokenize(ctx, input);
+	trace_end(ctx, "tokenize");
+	trace_begin(ctx, "validate_token_sequence");
+	valid = ctx->tokens && validate_token_sequence(ctx->tokens);
+	trace_end(ctx, "validate_token_sequence");
+	if (valid)
+		execute_list(ctx, ctx->tokens);
+	else
+		ctx->exit_status = 2;
+}
+
+/**
+ * @brief Cleans up resources after command execution
+ *
+ * Closes what the commands still hold, then resets the line arena which
+ * owns the tokens and commands, writes out the trace events of the line
+ * and updates signal status
+ *
+ * @param ctx Shell context
+ */
+void	cleanup_resources(t_ctx *ctx)
+{
+	ctx->tokens = NULL;
+	if (ctx->cmd)
+	{
+		free_all_commands(ctx->cmd);
+		ctx->cmd = NULL;
+	}
+	arena_print_stats(ctx);
+	arena_reset(&ctx->arena);
+	trace_flush(ctx);
+	update_signal_status(ctx);
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_reader.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:18:28 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:05:41 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "input.h"
+
+/**
+ * @brief Initializes a reader pulling its input from a file descriptor
+ *
+ * @param reader Reader to initialize
+ * @param fd File descriptor to read from
+ * @return bool true on success, false on allocation failure
+ */
+bool	reader_init_fd(t_reader *reader, int fd)
+{
+	reader->fd = fd;
+	reader->len = 0;
+	reader->pos = 0;
+	reader->cap = READER_BUF_SIZE;
+	reader->eof = false;
+	reader->owned = true;
+	reader->seekable = false;
+	reader->bytewise = false;
+	reader->buf = malloc(reader->cap);
+	return (reader->buf != NULL);
+}
+
+/**
+ * @brief Initializes a reader over an in-memory string (`-c` mode)
+ *
+ * @param reader Reader to initialize
+ * @param str String to read lines from (not copied, not freed)
+ */
+void	reader_init_str(t_reader *reader, char *str)
+{
+	reader->fd = -1;
+	reader->buf = str;
+	reader->len = ft_strlen(str);
+	reader->pos = 0;
+	reader->cap = reader->len;
+	reader->eof = true;
+	reader->owned = false;
+	reader->seekable = false;
+	reader->bytewise = false;
+}
+
+/**
+ * @brief Moves unread bytes to the front of the buffer and refills it
+ *
+ * The buffer is doubled when a single line does not fit in it. A bytewise
+ * reader takes one byte at a time, so that it never reads past a line.
+ *
+ * @param reader Reader to refill
+ * @return bool false on allocation or read error
+ */
+static bool	reader_fill(t_reader *reader)
+{
+	ssize_t	bytes;
+	size_t	want;
+
+	ft_memmove(reader->buf, reader->buf + reader->pos, reader->len
+		- reader->pos);
+	reader->len -= reader->pos;
+	reader->pos = 0;
+	if (reader->len == reader->cap && !reader_grow(reader))
+		return (false);
+	want = reader->cap - reader->len;
+	if (reader->bytewise)
+		want = 1;
+	bytes = read(reader->fd, reader->buf + reader->len, want);
+	if (bytes <= 0)
+		reader->eof = true;
+	else
+		reader->len += (size_t)bytes;
+	return (bytes >= 0);
+}
+
+/**
+ * @brief Returns the next line of input, without its trailing newline
+ *
+ * @param reader Reader to pull the line from
+ * @return char* Newly allocated line, or NULL at end of input
+ * @note Caller must free the returned string
+ */
+char	*reader_next_line(t_reader *reader)
+{
+	char	*nl;
+	char	*line;
+	size_t	line_len;
+
+	nl = ft_memchr(reader->buf + reader->pos, '\n', reader->len - reader->pos);
+	while (!nl && !reader->eof)
+	{
+		if (!reader_fill(reader))
+			return (NULL);
+		nl = ft_memchr(reader->buf + reader->pos, '\n', reader->len
+				- reader->pos);
+	}
+	if (!nl && reader->pos == reader->len)
+		return (NULL);
+	if (nl)
+		line_len = (size_t)(nl - (reader->buf + reader->pos));
+	else
+		line_len = reader->len - reader->pos;
+	line = ft_substr(reader->buf + reader->pos, 0, line_len);
+	reader->pos += line_len + (nl != NULL);
+	return (line);
+}
+
+/**
+ * @brief Releases the reader buffer and its file descriptor
+ *
+ * @param reader Reader to destroy
+ */
+void	reader_destroy(t_reader *reader)
+{
+	if (reader->owned)
+		free(reader->buf);
+	reader->buf = NULL;
+	if (reader->fd > STDERR_FILENO)
+		close(reader->fd);
+	reader->fd = -1;
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_reader_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:59:13 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:59:13 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "input.h"
+
+/**
+ * @brief Doubles the buffer of a reader, keeping what it holds
+ *
+ * @param reader Reader whose buffer is full
+ * @return bool false on allocation failure
+ */
+bool	reader_grow(t_reader *reader)
+{
+	char	*grown;
+
+	grown = malloc(reader->cap * 2);
+	if (!grown)
+		return (false);
+	ft_memcpy(grown, reader->buf, reader->len);
+	free(reader->buf);
+	reader->buf = grown;
+	reader->cap *= 2;
+	return (true);
+}
+
+/**
+ * @brief Makes a reader share its file descriptor with the commands it runs
+ *
+ * Used when the script comes from stdin (`minishell < script.sh`), which
+ * the commands inherit: what the reader has buffered must not be lost to
+ * them. A seekable input is handed back with reader_sync(); any other
+ * input is read one byte at a time, so nothing is read past a line.
+ *
+ * @param reader Reader over stdin
+ */
+void	reader_share(t_reader *reader)
+{
+	reader->seekable = (lseek(reader->fd, 0, SEEK_CUR) != -1);
+	reader->bytewise = !reader->seekable;
+}
+
+/**
+ * @brief Gives the bytes read ahead back to a shared input
+ *
+ * Called before commands are started, so that `head -n1` in a script
+ * read from stdin gets the next line of the script, as in bash. The
+ * buffer is dropped and read again from the file on the next line.
+ *
+ * @param reader Reader of the script, may be NULL
+ */
+void	reader_sync(t_reader *reader)
+{
+	off_t	ahead;
+
+	if (!reader || !reader->seekable || reader->pos == reader->len)
+		return ;
+	ahead = (off_t)(reader->len - reader->pos);
+	if (lseek(reader->fd, -ahead, SEEK_CUR) == -1)
+		return ;
+	reader->len = 0;
+	reader->pos = 0;
+	reader->eof = false;
+}
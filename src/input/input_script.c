@@ -0,0 +1,120 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_script.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:20:05 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:07:18 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "error.h"
+#include "input.h"
+#include "jobs.h"
+#include "path.h"
+#include "validation.h"
+
+/**
+ * @brief Runs every line of a reader through the shell, without readline
+ *
+ * No prompt is displayed and nothing is added to the history. Finished
+ * background jobs are collected between lines but only reported by `jobs`.
+ *
+ * @param ctx Shell context
+ * @param reader Reader providing the input lines
+ * @return int Final exit status
+ */
+int	run_script(t_ctx *ctx, t_reader *reader)
+{
+	char	*input;
+
+	ctx->reader = reader;
+	while (!ctx->exit_requested)
+	{
+		jobs_reap(ctx);
+		path_watch_poll(ctx);
+		input = reader_next_line(reader);
+		if (!input)
+			break ;
+		if (validate_input_length(input, ctx))
+			process_user_input(ctx, input);
+		cleanup_resources(ctx);
+		free(input);
+	}
+	ctx->reader = NULL;
+	return (ctx->exit_status);
+}
+
+/**
+ * @brief Runs the string given to `-c`
+ *
+ * @param ctx Shell context
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Final exit status
+ */
+static int	run_command_string(t_ctx *ctx, int argc, char **argv)
+{
+	t_reader	reader;
+
+	if (argc < 3)
+	{
+		error_print(NULL, "-c", "option requires an argument");
+		return (2);
+	}
+	reader_init_str(&reader, argv[2]);
+	return (run_script(ctx, &reader));
+}
+
+/**
+ * @brief Runs a script file given as first argument
+ *
+ * @param ctx Shell context
+ * @param path Path of the script
+ * @return int Final exit status
+ */
+static int	run_script_file(t_ctx *ctx, char *path)
+{
+	t_reader	reader;
+	int			fd;
+	int			status;
+
+	fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (error(path, NULL, ERR_NO_FILE));
+	if (!reader_init_fd(&reader, fd))
+	{
+		close(fd);
+		return (error(NULL, "reader", ERR_ALLOC));
+	}
+	status = run_script(ctx, &reader);
+	reader_destroy(&reader);
+	return (status);
+}
+
+/**
+ * @brief Non-interactive entrypoint: `-c string`, script file or stdin
+ *
+ * @param ctx Shell context
+ * @param argc Argument count
+ * @param argv Argument values
+ * @return int Final exit status
+ */
+int	run_from_args(t_ctx *ctx, int argc, char **argv)
+{
+	t_reader	reader;
+	int			status;
+
+	if (argc > 1 && ft_strncmp(argv[1], "-c", 3) == 0)
+		return (run_command_string(ctx, argc, argv));
+	if (argc > 1)
+		return (run_script_file(ctx, argv[1]));
+	if (!reader_init_fd(&reader, STDIN_FILENO))
+		return (error(NULL, "reader", ERR_ALLOC));
+	reader_share(&reader);
+	status = run_script(ctx, &reader);
+	reader_destroy(&reader);
+	return (status);
+}
@@ -0,0 +1,146 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_reap.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:53:18 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:36:35 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "jobs.h"
+
+/**
+ * @brief Records how a job ended, in the form `$?` would report it
+ *
+ * @param ctx Shell context
+ * @param pid Process that was reaped
+ * @param wstatus Status returned by waitpid()
+ * @return bool true if the process was a job
+ */
+bool	jobs_record(t_ctx *ctx, pid_t pid, int wstatus)
+{
+	t_job	*job;
+	int		i;
+
+	i = 0;
+	while (i < ctx->job_count && ctx->jobs[i].pid != pid)
+		i++;
+	if (i == ctx->job_count)
+		return (false);
+	job = &ctx->jobs[i];
+	job->state = JOB_DONE;
+	job_reaper_forget(pid);
+	if (WIFEXITED(wstatus))
+		job->status = WEXITSTATUS(wstatus);
+	else if (WIFSIGNALED(wstatus))
+		job->status = 128 + WTERMSIG(wstatus);
+	return (true);
+}
+
+/**
+ * @brief Records the jobs that have finished
+ *
+ * Jobs are reaped as soon as they exit by the SIGCHLD handler (see
+ * job_sigchld.c); their statuses are moved into the table here, before
+ * each prompt, line of a script, `jobs` or `wait`, with no syscall.
+ *
+ * @param ctx Shell context
+ */
+void	jobs_reap(t_ctx *ctx)
+{
+	t_job_reaper	*reaper;
+	int				i;
+
+	reaper = job_reaper();
+	i = 0;
+	while (i < JOB_MAX)
+	{
+		if (reaper->pid[i] > 0 && reaper->done[i])
+			jobs_record(ctx, reaper->pid[i], reaper->status[i]);
+		i++;
+	}
+}
+
+/**
+ * @brief Waits for a job to finish
+ *
+ * @param ctx Shell context
+ * @param index Index of the job in the table
+ * @return int Exit status of the job
+ */
+int	job_wait(t_ctx *ctx, int index)
+{
+	t_job	*job;
+	int		wstatus;
+	pid_t	pid;
+
+	job = &ctx->jobs[index];
+	while (job->state == JOB_RUNNING)
+	{
+		pid = waitpid(job->pid, &wstatus, 0);
+		if (pid == job->pid)
+			jobs_record(ctx, pid, wstatus);
+		else if (pid == -1 && errno == ECHILD)
+			jobs_reap(ctx);
+		if (pid == -1 && errno != EINTR && job->state == JOB_RUNNING)
+			job->state = JOB_DONE;
+	}
+	return (job->status);
+}
+
+/**
+ * @brief Prints a job in bash's `jobs` format
+ *
+ * @param out Output buffer
+ * @param job Job to print
+ */
+void	job_print(t_outbuf *out, t_job *job)
+{
+	static const char	pad[] = "                        ";
+	int					width;
+
+	ft_buf_printf(out, "[%d]  ", job->id);
+	if (job->state == JOB_RUNNING)
+		width = ft_buf_printf(out, "Running");
+	else if (job->status == 0)
+		width = ft_buf_printf(out, "Done");
+	else
+		width = ft_buf_printf(out, "Exit %d", job->status);
+	if (width < 0 || width >= (int)sizeof(pad))
+		width = sizeof(pad) - 2;
+	ft_buf_printf(out, "%s%s", pad + width, job->text);
+	if (job->state == JOB_RUNNING)
+		ft_outbuf_putstr(out, " &");
+	ft_outbuf_write(out, "\n", 1);
+}
+
+/**
+ * @brief Reports the jobs that finished since the last prompt
+ *
+ * The reported jobs are forgotten, as in an interactive bash.
+ *
+ * @param ctx Shell context
+ */
+void	jobs_notify(t_ctx *ctx)
+{
+	t_outbuf	err;
+	int			i;
+
+	jobs_reap(ctx);
+	ft_outbuf_init(&err, STDERR_FILENO);
+	i = 0;
+	while (i < ctx->job_count)
+	{
+		if (ctx->jobs[i].state == JOB_DONE)
+		{
+			job_print(&err, &ctx->jobs[i]);
+			job_remove(ctx, i);
+		}
+		else
+			i++;
+	}
+	ft_outbuf_flush(&err);
+}
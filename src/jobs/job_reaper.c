@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_reaper.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:31:44 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:31:44 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "jobs.h"
+
+/**
+ * @brief Registers a background job for the SIGCHLD handler
+ *
+ * The process ID is written last, so that the handler never sees a slot
+ * half filled. The job may have exited before it was registered, its
+ * SIGCHLD then gone unanswered, so the table is scanned once right away.
+ *
+ * @param pid Process ID of the job
+ */
+void	job_reaper_add(pid_t pid)
+{
+	t_job_reaper	*reaper;
+	int				i;
+
+	reaper = job_reaper();
+	i = 0;
+	while (i < JOB_MAX && reaper->pid[i] != 0)
+		i++;
+	if (i == JOB_MAX)
+		return ;
+	reaper->done[i] = 0;
+	reaper->status[i] = 0;
+	reaper->pid[i] = pid;
+	job_reaper_scan();
+}
+
+/**
+ * @brief Unregisters a job, once its status is in the job table
+ *
+ * @param pid Process ID of the job
+ */
+void	job_reaper_forget(pid_t pid)
+{
+	t_job_reaper	*reaper;
+	int				i;
+
+	reaper = job_reaper();
+	i = 0;
+	while (i < JOB_MAX)
+	{
+		if (reaper->pid[i] == pid)
+			reaper->pid[i] = 0;
+		i++;
+	}
+}
+
+/**
+ * @brief Unregisters every job, in the shell leaving or in a background
+ * job, which does not own the shell's jobs
+ */
+void	job_reaper_clear(void)
+{
+	t_job_reaper	*reaper;
+	int				i;
+
+	reaper = job_reaper();
+	i = 0;
+	while (i < JOB_MAX)
+		reaper->pid[i++] = 0;
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_sigchld.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:30:07 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:30:07 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "jobs.h"
+
+/**
+ * @brief Returns the table shared with the SIGCHLD handler
+ *
+ * @return t_job_reaper* The only table, zeroed at startup
+ */
+t_job_reaper	*job_reaper(void)
+{
+	static t_job_reaper	reaper;
+
+	return (&reaper);
+}
+
+/**
+ * @brief Reaps the registered jobs that have exited
+ *
+ * Only the process IDs registered in the table are waited for: the
+ * children of a foreground pipeline are left to wait_for_children(). The
+ * raw statuses are moved into the job table later, outside the handler,
+ * by jobs_reap(). Safe to run from the handler and from the shell alike:
+ * only one of two waitpid() calls on a process can reap it.
+ */
+void	job_reaper_scan(void)
+{
+	t_job_reaper	*reaper;
+	int				wstatus;
+	int				i;
+
+	reaper = job_reaper();
+	i = 0;
+	while (i < JOB_MAX)
+	{
+		if (reaper->pid[i] > 0 && !reaper->done[i]
+			&& waitpid(reaper->pid[i], &wstatus, WNOHANG) == reaper->pid[i])
+		{
+			reaper->status[i] = wstatus;
+			reaper->done[i] = 1;
+		}
+		i++;
+	}
+}
+
+/**
+ * @brief Reaps the background jobs as soon as they exit
+ *
+ * @param sig Signal number (SIGCHLD)
+ */
+static void	job_sigchld(int sig)
+{
+	int	saved_errno;
+
+	(void)sig;
+	saved_errno = errno;
+	job_reaper_scan();
+	errno = saved_errno;
+}
+
+/**
+ * @brief Installs the SIGCHLD handler, once at startup
+ *
+ * SA_RESTART keeps readline and blocking waits going when a job exits;
+ * SA_NOCLDSTOP ignores children that are only stopped.
+ */
+void	job_sigchld_init(void)
+{
+	struct sigaction	sa_chld;
+
+	sigemptyset(&sa_chld.sa_mask);
+	sa_chld.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+	sa_chld.sa_handler = job_sigchld;
+	sigaction(SIGCHLD, &sa_chld, NULL);
+}
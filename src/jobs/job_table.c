@@ -0,0 +1,123 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:51:41 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:38:12 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "jobs.h"
+
+/**
+ * @brief Rebuilds the command line of a job from its tokens
+ *
+ * @param tokens First token of the job, which ends at `&`
+ * @return char* Allocated text, or NULL if allocation fails
+ */
+static char	*job_text(t_token *tokens)
+{
+	t_strbuf	sb;
+
+	ft_strbuf_init(&sb);
+	while (tokens && tokens->type != TOK_ESP)
+	{
+		if ((sb.len && !ft_strbuf_append(&sb, " ", 1))
+			|| !ft_strbuf_append(&sb, tokens->value,
+				ft_strlen(tokens->value)))
+		{
+			ft_strbuf_free(&sb);
+			return (NULL);
+		}
+		tokens = tokens->next;
+	}
+	return (sb.data);
+}
+
+/**
+ * @brief Records a job started in the background
+ *
+ * Job numbers follow the highest one in use, like bash's.
+ *
+ * @param ctx Shell context
+ * @param pid Process (and process group) ID of the job
+ * @param tokens First token of the job
+ * @return int Job number, or -1 if the table is full or allocation fails
+ */
+int	job_add(t_ctx *ctx, pid_t pid, t_token *tokens)
+{
+	t_job	*job;
+
+	if (ctx->job_count == JOB_MAX)
+		return (-1);
+	job = &ctx->jobs[ctx->job_count];
+	job->text = job_text(tokens);
+	if (!job->text)
+		return (-1);
+	job->id = 1;
+	if (ctx->job_count)
+		job->id = ctx->jobs[ctx->job_count - 1].id + 1;
+	job->pid = pid;
+	job->state = JOB_RUNNING;
+	job->status = 0;
+	ctx->job_count++;
+	job_reaper_add(pid);
+	return (job->id);
+}
+
+/**
+ * @brief Forgets a job, keeping the table in job number order
+ *
+ * @param ctx Shell context
+ * @param index Index of the job in the table
+ */
+void	job_remove(t_ctx *ctx, int index)
+{
+	job_reaper_forget(ctx->jobs[index].pid);
+	free(ctx->jobs[index].text);
+	ctx->job_count--;
+	ft_memmove(&ctx->jobs[index], &ctx->jobs[index + 1],
+		(ctx->job_count - index) * sizeof(t_job));
+}
+
+/**
+ * @brief Finds a job from a `%n`, `%%`, `%+` or process ID argument
+ *
+ * @param ctx Shell context
+ * @param spec Job specification
+ * @return int Index of the job in the table, or -1 if there is none
+ */
+int	job_find(t_ctx *ctx, const char *spec)
+{
+	int	i;
+	int	n;
+
+	if (spec[0] == '%' && (!spec[1] || ((spec[1] == '%' || spec[1] == '+')
+				&& !spec[2])))
+		return (ctx->job_count - 1);
+	n = ft_atoi(spec + (spec[0] == '%'));
+	i = 0;
+	while (i < ctx->job_count)
+	{
+		if ((spec[0] == '%' && ctx->jobs[i].id == n)
+			|| (spec[0] != '%' && ctx->jobs[i].pid == n))
+			return (i);
+		i++;
+	}
+	return (-1);
+}
+
+/**
+ * @brief Forgets every job without waiting for them
+ *
+ * @param ctx Shell context
+ */
+void	jobs_clear(t_ctx *ctx)
+{
+	while (ctx->job_count)
+		job_remove(ctx, ctx->job_count - 1);
+	job_reaper_clear();
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_class.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:42:21 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 11:42:21 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "lexer.h"
+
+/**
+ * @brief Returns the lexical class of a character
+ *
+ * Classes come from a 256-entry read-only table, so classifying a
+ * character is a single load instead of a chain of comparisons. Every
+ * character that is not listed is a word character (LEX_WORD).
+ *
+ * @param c Character to classify
+ * @return unsigned char Class bits (LEX_*)
+ */
+unsigned char	lex_class(unsigned char c)
+{
+	static const unsigned char	table[256] = {
+	['\0'] = LEX_END,
+	['\n'] = LEX_NEWLINE,
+	[' '] = LEX_BLANK,
+	['\t'] = LEX_BLANK,
+	['|'] = LEX_OPERATOR,
+	['<'] = LEX_OPERATOR,
+	['>'] = LEX_OPERATOR,
+	['&'] = LEX_OPERATOR,
+	['"'] = LEX_QUOTE,
+	['\''] = LEX_QUOTE,
+	['$'] = LEX_DOLLAR,
+	};
+
+	return (table[c]);
+}
+
+/**
+ * @brief Checks if a character continues an unquoted run of a word
+ *
+ * @param c Character to check
+ * @return bool true for word characters and `$`
+ */
+bool	lex_is_word(unsigned char c)
+{
+	return (!(lex_class(c) & LEX_WORD_END));
+}
@@ -6,73 +6,60 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/10 14:27:07 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:24:30 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:47:12 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "lexer.h"
+#include "memory.h"
 
 /**
- * @brief Extract a word from lexer input
+ * @brief Appends an unquoted run of the input to the word being built
  *
  * @param lexer Pointer to lexer structure
- * @return Newly allocated string containing the word or NULL on error
- * @note Caller must free the returned string
+ * @return bool false on allocation failure
  */
-char	*read_word_lexer(t_lexer *lexer)
+bool	read_word_lexer(t_lexer *lexer)
 {
 	int		start;
-	int		length;
-	char	*word;
 
 	start = lexer->position;
-	while (get_lexer(lexer) != '\0' && get_lexer(lexer) != ' '
-		&& get_lexer(lexer) != '\t' && get_lexer(lexer) != '\n'
-		&& get_lexer(lexer) != '|' && get_lexer(lexer) != '<'
-		&& get_lexer(lexer) != '>' && get_lexer(lexer) != '&'
-		&& get_lexer(lexer) != '"' && get_lexer(lexer) != '\'')
-		advance_lexer(lexer);
-	length = lexer->position - start;
-	if (length == 0)
-		return (ft_strdup(""));
-	word = malloc((unsigned long)length + 1);
-	if (!word)
-		return (NULL);
-	ft_strlcpy(word, lexer->input + start, (size_t)length + 1);
-	word[length] = '\0';
-	return (word);
+	lexer->position += (int)lex_word_run(lexer->input + start,
+			(size_t)(lexer->length - start));
+	return (ft_strbuf_append(&lexer->word, lexer->input + start,
+			(size_t)(lexer->position - start)));
 }
 
 /**
- * @brief Extract a quoted string from lexer input
+ * @brief Appends the content of a quoted string to the word being built
  *
  * @param lexer Pointer to lexer structure
  * @param quote_char Quote character (' or ")
- * @return Newly allocated string containing the quoted content or NULL on error
- * @note Caller must free the returned string
+ * @return bool false on unclosed quote or allocation failure
  */
-char	*read_quoted_string_lexer(t_lexer *lexer, char quote_char)
+bool	read_quoted_string_lexer(t_lexer *lexer, char quote_char)
 {
 	int		start;
-	int		end;
-	char	*content;
+	char	*end;
 
 	start = lexer->position + 1;
-	advance_lexer(lexer);
-	while (get_lexer(lexer) != '\0' && get_lexer(lexer) != quote_char
-		&& lexer->position < lexer->length)
-		advance_lexer(lexer);
-	if (lexer->position >= lexer->length)
+	end = ft_memchr(lexer->input + start, quote_char,
+			(size_t)(lexer->length - start));
+	lexer->position = lexer->length;
+	if (end)
+		lexer->position = (int)(end - lexer->input);
+	if (!end)
 	{
 		ft_printf_fd(STDERR_FILENO,
 			"minishell: syntax error near unexpected unclosed quote\n");
-		return (NULL);
+		return (false);
 	}
-	end = lexer->position;
 	set_quote_flags(lexer, quote_char);
+	if (!ft_strbuf_append(&lexer->word, lexer->input + start,
+			(size_t)(lexer->position - start)))
+		return (false);
 	advance_lexer(lexer);
-	content = create_quoted_content(lexer, start, end);
-	return (content);
+	return (true);
 }
 
 /**
@@ -83,54 +70,47 @@ char	*read_quoted_string_lexer(t_lexer *lexer, char quote_char)
  */
 static int	peek_lexer(t_lexer *lexer)
 {
-	char	current;
-
-	current = get_lexer(lexer);
-	return (current != '\0' && current != ' ' && current != '\t'
-		&& current != '\n' && current != '|' && current != '<' && current != '>'
-		&& current != '&');
+	return (!(lex_class((unsigned char)get_lexer(lexer)) & LEX_TOKEN_END));
 }
 
 /**
- * @brief Processes a complex word with potential quote handling
+ * @brief Builds a complex word, with its quoted parts, into the lexer buffer
  *
  * @param lexer Pointer to lexer structure
  * @param has_quotes Pointer to flag indicating if quotes were encountered
- * @return Processed word as a newly allocated string, or NULL on error
+ * @return bool false on error
  */
-char	*process_complex_word(t_lexer *lexer, int *has_quotes)
+static bool	process_complex_word(t_lexer *lexer, int *has_quotes)
 {
-	char	*result;
 	char	quote_char;
 
-	result = NULL;
+	ft_strbuf_clear(&lexer->word);
 	while (peek_lexer(lexer))
 	{
-		if (get_lexer(lexer) == '"' || get_lexer(lexer) == '\'')
+		if (lex_class((unsigned char)get_lexer(lexer)) & LEX_QUOTE)
 		{
 			*has_quotes = 1;
 			quote_char = get_lexer(lexer);
 		}
 		else
 			quote_char = 0;
-		result = handle_word_part_by_type(lexer, result, quote_char);
-		if (!result)
-			return (NULL);
+		if (!handle_word_part_by_type(lexer, quote_char))
+			return (false);
 	}
-	if (!result)
-		result = ft_strdup("");
-	return (result);
+	return (true);
 }
 
 /**
  * @brief Reads a complex word that might contain various elements
  *
+ * The word is assembled in the lexer's reusable buffer and copied once
+ * into the line arena.
+ *
  * @param lexer Pointer to lexer structure
- * @return Newly allocated string containing the word or NULL on error
+ * @return Word owned by the line arena or NULL on error
  */
 char	*read_complex_word(t_lexer *lexer)
 {
-	char	*result;
 	int		start_pos;
 	int		has_quotes;
 
@@ -139,15 +119,13 @@ char	*read_complex_word(t_lexer *lexer)
 	if (lexer->input[start_pos] == '"' && start_pos + 1 < lexer->length
 		&& lexer->input[start_pos + 1] == '"')
 		has_quotes = 1;
-	result = process_complex_word(lexer, &has_quotes);
-	if (!result && has_quotes)
-		return (ft_strdup(""));
-	if ((result && result[0] == '\0') && has_quotes)
+	if (!process_complex_word(lexer, &has_quotes))
 	{
-		free(result);
-		return (ft_strdup("\1"));
+		if (has_quotes)
+			return (arena_strdup(lexer->arena, ""));
+		return (NULL);
 	}
-	if (!result)
-		return (ft_strdup(""));
-	return (result);
+	if (lexer->word.len == 0 && has_quotes)
+		return (arena_strdup(lexer->arena, "\1"));
+	return (arena_strndup(lexer->arena, lexer->word.data, lexer->word.len));
 }
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/04/21 16:01:00 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:24:50 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 16:47:54 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -26,53 +26,18 @@ void	set_quote_flags(t_lexer *lexer, char quote_char)
 		lexer->quote.in_single_quote = 1;
 }
 
-/**
- * @brief Create a string from the quoted content
- *
- * @param lexer Pointer to lexer structure
- * @param start Start position of the content
- * @param end End position of the content
- * @return char* Allocated string containing content or NULL on error
- */
-char	*create_quoted_content(t_lexer *lexer, int start, int end)
-{
-	char	*content;
-
-	if (start == end)
-		return (ft_strdup(""));
-	content = malloc((end - start + 1));
-	if (!content)
-		return (NULL);
-	ft_strlcpy(content, lexer->input + start, (size_t)(end - start + 1));
-	content[end - start] = '\0';
-	return (content);
-}
-
 /**
  * @brief Handles a single part of a complex word
  *
+ * Both kinds of parts are appended to the lexer's word buffer.
+ *
  * @param lexer Current lexer state
- * @param result Current result string
  * @param quote_char Quote character if in quoted mode, 0 otherwise
- * @return char* Updated result string or NULL on error
+ * @return bool false on error
  */
-char	*handle_word_part_by_type(t_lexer *lexer, char *result, char quote_char)
+bool	handle_word_part_by_type(t_lexer *lexer, char quote_char)
 {
-	char	*new_result;
-	char	*part;
-
 	if (quote_char != 0)
-	{
-		part = read_quoted_string_lexer(lexer, quote_char);
-		if (!part)
-		{
-			free(result);
-			return (NULL);
-		}
-		new_result = join_and_free(result, part);
-		free(part);
-		return (new_result);
-	}
-	else
-		return (handle_word_part(lexer, result));
+		return (read_quoted_string_lexer(lexer, quote_char));
+	return (read_word_lexer(lexer));
 }
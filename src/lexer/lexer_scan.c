@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   lexer_scan.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:43:58 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 11:43:58 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "lexer.h"
+#if defined(__AVX2__)
+# include <immintrin.h>
+
+/**
+ * @brief Flags the bytes of a 32-byte block that end a run of word chars
+ *
+ * @param s Block to inspect (unaligned, fully readable)
+ * @return unsigned int Bit i set if s[i] ends the run
+ */
+static unsigned int	lex_block_mask(const char *s)
+{
+	__m256i	v;
+	__m256i	m;
+
+	v = _mm256_loadu_si256((const __m256i *)s);
+	m = _mm256_cmpeq_epi8(v, _mm256_setzero_si256());
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('|')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('&')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\'')));
+	return ((unsigned int)_mm256_movemask_epi8(m));
+}
+
+# define LEX_BLOCK 32
+#elif defined(__SSE2__)
+# include <emmintrin.h>
+
+/**
+ * @brief Flags the bytes of a 16-byte block that end a run of word chars
+ *
+ * @param s Block to inspect (unaligned, fully readable)
+ * @return unsigned int Bit i set if s[i] ends the run
+ */
+static unsigned int	lex_block_mask(const char *s)
+{
+	__m128i	v;
+	__m128i	m;
+
+	v = _mm_loadu_si128((const __m128i *)s);
+	m = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('|')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('<')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('>')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('&')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('"')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\'')));
+	return ((unsigned int)_mm_movemask_epi8(m));
+}
+
+# define LEX_BLOCK 16
+#endif
+
+#ifdef LEX_BLOCK
+
+/**
+ * @brief Measures the run of word characters at the start of a string
+ *
+ * Whole blocks are checked with SIMD compares against every character of
+ * the LEX_WORD_END classes; the tail uses the class table.
+ *
+ * @param s String to scan
+ * @param len Number of readable bytes in s
+ * @return size_t Length of the run
+ */
+size_t	lex_word_run(const char *s, size_t len)
+{
+	size_t			i;
+	unsigned int	mask;
+
+	i = 0;
+	while (i + LEX_BLOCK <= len)
+	{
+		mask = lex_block_mask(s + i);
+		if (mask)
+			return (i + (size_t)__builtin_ctz(mask));
+		i += LEX_BLOCK;
+	}
+	while (i < len && lex_is_word((unsigned char)s[i]))
+		i++;
+	return (i);
+}
+
+#else
+
+/**
+ * @brief Measures the run of word characters at the start of a string
+ *
+ * @param s String to scan
+ * @param len Number of readable bytes in s
+ * @return size_t Length of the run
+ */
+size_t	lex_word_run(const char *s, size_t len)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < len && lex_is_word((unsigned char)s[i]))
+		i++;
+	return (i);
+}
+
+#endif
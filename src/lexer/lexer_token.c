@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/10 14:31:33 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:25:24 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:39:07 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -22,18 +22,11 @@
 static t_token	*handle_word_token(t_lexer *lexer)
 {
 	char	*word;
-	t_token	*token;
 
 	word = read_complex_word(lexer);
 	if (!word)
 		return (NULL);
-	token = create_token(TOK_WORD, word);
-	if (!token)
-	{
-		free(word);
-		return (NULL);
-	}
-	return (token);
+	return (create_token(lexer->arena, TOK_WORD, word));
 }
 
 /**
@@ -41,7 +34,7 @@ static t_token	*handle_word_token(t_lexer *lexer)
  *
  * @param lexer Pointer to lexer structure
  * @return Next token or NULL on error
- * @note Caller must free the returned token
+ * @note The token is owned by the lexer arena
  */
 t_token	*next_token_lexer(t_lexer *lexer)
 {
@@ -70,42 +63,3 @@ t_token	*next_token_lexer(t_lexer *lexer)
 	}
 	return (NULL);
 }
-
-/**
- * @brief Frees a single token
- *
- * @param token Token to free
- */
-static void	free_token(t_token *token)
-{
-	if (!token)
-		return ;
-	if (token->value)
-	{
-		free(token->value);
-		token->value = NULL;
-	}
-	free(token);
-}
-
-/**
- * @brief Frees all tokens in a linked list
- *
- * This function releases the memory allocated for all tokens
- * in a linked list, starting from the given token.
- *
- * @param token First token in the list
- */
-void	free_all_token(t_token *token)
-{
-	t_token	*current;
-	t_token	*next;
-
-	current = token;
-	while (current)
-	{
-		next = current->next;
-		free_token(current);
-		current = next;
-	}
-}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/08 13:58:39 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 14:33:43 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -23,3 +23,37 @@ bool	token_is_redirection(t_token_type type)
 	return (type == TOK_REDIR_FROM || type == TOK_REDIR_TO
 		|| type == TOK_HERE_DOC_FROM || type == TOK_HERE_DOC_TO);
 }
+
+/**
+ * @brief Checks if a token is a list operator (`&&` or `||`)
+ *
+ * @param type Token type to check
+ * @return bool true if token separates two pipelines of an and-or list
+ */
+bool	token_is_list_operator(t_token_type type)
+{
+	return (type == TOK_AND || type == TOK_OR);
+}
+
+/**
+ * @brief Checks if a token ends a pipeline inside a list (`&&`, `||`, `&`)
+ *
+ * @param type Token type to check
+ * @return bool true if the pipeline being parsed stops at this token
+ */
+bool	token_is_separator(t_token_type type)
+{
+	return (type == TOK_AND || type == TOK_OR || type == TOK_ESP);
+}
+
+/**
+ * @brief Checks if a token cannot start the operand of an operator
+ *
+ * @param type Token type following `|`, `&&`, `||` or a redirection
+ * @return bool true if the operator is missing its right-hand side
+ */
+bool	token_is_missing_operand(t_token_type type)
+{
+	return (type == TOK_PIPE || type == TOK_AND || type == TOK_OR
+		|| type == TOK_ESP || type == TOK_EOF || type == TOK_NEW_LINE);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/13 15:53:31 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 14:25:46 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 10:02:07 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -19,11 +19,11 @@ t_token	*handle_basics_token(t_lexer *lexer)
 
 	current = get_lexer(lexer);
 	if (current == '\0')
-		return (create_token(TOK_EOF, NULL));
+		return (create_token(lexer->arena, TOK_EOF, NULL));
 	if (current == '\n')
 	{
 		advance_lexer(lexer);
-		return (create_token(TOK_NEW_LINE, ft_strdup("\n")));
+		return (create_token(lexer->arena, TOK_NEW_LINE, "\n"));
 	}
 	return (NULL);
 }
@@ -39,9 +39,9 @@ t_token	*handle_pipe_and_token(t_lexer *lexer)
 		if (get_lexer(lexer) == '|')
 		{
 			advance_lexer(lexer);
-			return (create_token(TOK_OR, ft_strdup("||")));
+			return (create_token(lexer->arena, TOK_OR, "||"));
 		}
-		return (create_token(TOK_PIPE, ft_strdup("|")));
+		return (create_token(lexer->arena, TOK_PIPE, "|"));
 	}
 	if (current == '&')
 	{
@@ -49,9 +49,9 @@ t_token	*handle_pipe_and_token(t_lexer *lexer)
 		if (get_lexer(lexer) == '&')
 		{
 			advance_lexer(lexer);
-			return (create_token(TOK_AND, ft_strdup("&&")));
+			return (create_token(lexer->arena, TOK_AND, "&&"));
 		}
-		return (create_token(TOK_ESP, ft_strdup("&")));
+		return (create_token(lexer->arena, TOK_ESP, "&"));
 	}
 	return (NULL);
 }
@@ -67,9 +67,9 @@ t_token	*handle_redir_from_and_to_token(t_lexer *lexer)
 		if (get_lexer(lexer) == '<')
 		{
 			advance_lexer(lexer);
-			return (create_token(TOK_HERE_DOC_FROM, ft_strdup("<<")));
+			return (create_token(lexer->arena, TOK_HERE_DOC_FROM, "<<"));
 		}
-		return (create_token(TOK_REDIR_FROM, ft_strdup("<")));
+		return (create_token(lexer->arena, TOK_REDIR_FROM, "<"));
 	}
 	else if (current == '>')
 	{
@@ -77,9 +77,9 @@ t_token	*handle_redir_from_and_to_token(t_lexer *lexer)
 		if (get_lexer(lexer) == '>')
 		{
 			advance_lexer(lexer);
-			return (create_token(TOK_HERE_DOC_TO, ft_strdup(">>")));
+			return (create_token(lexer->arena, TOK_HERE_DOC_TO, ">>"));
 		}
-		return (create_token(TOK_REDIR_TO, ft_strdup(">")));
+		return (create_token(lexer->arena, TOK_REDIR_TO, ">"));
 	}
 	return (NULL);
 }
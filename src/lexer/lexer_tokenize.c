@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/14 15:28:06 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 14:26:23 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:40:44 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,7 +44,6 @@ static int	build_token_list(t_lexer *lexer, t_token **head)
 		token = next_token_lexer(lexer);
 		if (!token)
 		{
-			free_all_token(*head);
 			*head = NULL;
 			return (0);
 		}
@@ -60,29 +59,27 @@ static int	build_token_list(t_lexer *lexer, t_token **head)
  *
  * @param ctx Context for error handling
  * @param input The input string to tokenize
- * @return Linked list of tokens or NULL on error
+ * @return Linked list of tokens (owned by the line arena) or NULL on error
  */
 t_token	*tokenize(t_ctx *ctx, char *input)
 {
-	t_lexer	*lexer;
+	t_lexer	lexer;
 	t_token	*head;
 
 	head = NULL;
 	if (!input)
 		return (NULL);
-	lexer = safe_malloc(ctx, sizeof(t_lexer), "lexer");
-	lexer->input = input;
-	lexer->position = 0;
-	lexer->status = 0;
-	lexer->length = (int)ft_strlen(input);
-	lexer->quote.in_double_quote = 0;
-	lexer->quote.in_single_quote = 0;
-	if (!build_token_list(lexer, &head))
-	{
-		free(lexer);
-		return (NULL);
-	}
-	sync_quote_state(ctx, lexer);
-	free(lexer);
+	lexer.input = input;
+	lexer.arena = &ctx->arena;
+	lexer.position = 0;
+	lexer.status = 0;
+	lexer.length = (int)ft_strlen(input);
+	lexer.quote.in_double_quote = 0;
+	lexer.quote.in_single_quote = 0;
+	ft_strbuf_init(&lexer.word);
+	if (!build_token_list(&lexer, &head))
+		return (ft_strbuf_free(&lexer.word), NULL);
+	ft_strbuf_free(&lexer.word);
+	sync_quote_state(ctx, &lexer);
 	return (head);
 }
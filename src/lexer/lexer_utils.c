@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/05 19:17:06 by maximart          #+#    #+#             */
-/*   Updated: 2025/05/06 15:06:26 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 11:48:49 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -43,7 +43,7 @@ void	advance_lexer(t_lexer *lexer)
  */
 void	skip_whitespace_lexer(t_lexer *lexer)
 {
-	while (get_lexer(lexer) == ' ' || get_lexer(lexer) == '\t')
+	while (lex_class((unsigned char)get_lexer(lexer)) & LEX_BLANK)
 		advance_lexer(lexer);
 }
 
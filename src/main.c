@@ -6,67 +6,24 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/03/17 18:10:00 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/07 11:44:38 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 15:57:47 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "checker.h"
-#include "commands.h"
-#include "execute.h"
 #include "free.h"
 #include "init.h"
-#include "lexer.h"
+#include "input.h"
+#include "jobs.h"
+#include "path.h"
 #include "signals.h"
 #include "validation.h"
 
-/**
- * @brief Processes user input and executes commands
- *
- * Handles tokenization, parsing, and execution of user input
- *
- * @param ctx Shell context
- * @param input User input string
- */
-static void	process_user_input(t_ctx *ctx, char *input)
-{
-	ctx->tokens = tokenize(ctx, input);
-	if (ctx->tokens && validate_token_sequence(ctx->tokens))
-	{
-		ctx->cmd = command_parse(ctx, ctx->tokens);
-		if (ctx->cmd)
-			execute_commands(ctx, ctx->cmd);
-	}
-	else
-		ctx->exit_status = 2;
-}
-
-/**
- * @brief Cleans up resources after command execution
- *
- * Frees tokens and commands, updates signal status
- *
- * @param ctx Shell context
- */
-static void	cleanup_resources(t_ctx *ctx)
-{
-	if (ctx->tokens)
-	{
-		free_all_token(ctx->tokens);
-		ctx->tokens = NULL;
-	}
-	if (ctx->cmd)
-	{
-		free_all_commands(ctx->cmd);
-		ctx->cmd = NULL;
-	}
-	update_signal_status(ctx);
-}
-
 /**
  * @brief Main command loop for the shell
  *
  * Reads user input, processes commands in a loop,
- * and manages the shell's main control flow
+ * and manages the shell's main control flow. The background jobs that
+ * finished are reported before each prompt.
  *
  * @param ctx Shell context
  * @return int Final exit status
@@ -78,6 +35,8 @@ static int	command_loop(t_ctx *ctx)
 	while (!ctx->exit_requested)
 	{
 		setup_interactive_signals();
+		jobs_notify(ctx);
+		path_watch_poll(ctx);
 		input = readline("$ ");
 		if (!input)
 		{
@@ -98,7 +57,8 @@ static int	command_loop(t_ctx *ctx)
 /**
  * @brief Main entrypoint for the minishell program
  *
- * Initializes context, sets up signals, runs command loop
+ * Initializes context, then either runs the interactive command loop or,
+ * when given `-c`, a script path or a non-tty stdin, the script runner
  *
  * @param argc Argument count
  * @param argv Argument values
@@ -110,14 +70,14 @@ int	main(int argc, char **argv, char **envp)
 	t_ctx	*ctx;
 	int		final_status;
 
-	if (!isatty(STDOUT_FILENO) || !isatty(STDIN_FILENO))
+	ctx = init_ctx(argc, argv, envp);
+	if (argc > 1 || !isatty(STDIN_FILENO))
+		final_status = run_from_args(ctx, argc, argv);
+	else
 	{
-		ft_printf_fd(2, "not a tty\n");
-		exit(EXIT_FAILURE);
+		setup_interactive_signals();
+		final_status = command_loop(ctx);
 	}
-	ctx = init_ctx(argc, argv, envp);
-	setup_interactive_signals();
-	final_status = command_loop(ctx);
 	ctx_clear(ctx);
 	return (final_status);
 }
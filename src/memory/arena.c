@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:31:24 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 09:31:24 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "memory.h"
+
+/**
+ * @brief Allocates a new chunk and links it right after the current one
+ *
+ * Chunks following the current one are kept, so that they can be reused
+ * after a reset.
+ *
+ * @param arena Arena to grow
+ * @param size Minimum usable size of the chunk
+ * @return t_arena_chunk* New chunk or NULL on allocation failure
+ */
+static t_arena_chunk	*arena_grow(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+
+	if (size < ARENA_CHUNK_SIZE)
+		size = ARENA_CHUNK_SIZE;
+	chunk = malloc(sizeof(t_arena_chunk) + size);
+	if (!chunk)
+		return (NULL);
+	arena->mallocs++;
+	chunk->data = (char *)(chunk + 1);
+	chunk->size = size;
+	chunk->used = 0;
+	chunk->next = NULL;
+	if (arena->current)
+	{
+		chunk->next = arena->current->next;
+		arena->current->next = chunk;
+	}
+	else
+		arena->head = chunk;
+	arena->current = chunk;
+	return (chunk);
+}
+
+/**
+ * @brief Makes the current chunk able to hold `size` more bytes
+ *
+ * Reuses the chunks left over from previous lines before allocating.
+ *
+ * @param arena Arena to prepare
+ * @param size Aligned size requested
+ * @return t_arena_chunk* Chunk to allocate from, or NULL on failure
+ */
+static t_arena_chunk	*arena_fit(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+
+	chunk = arena->current;
+	while (chunk && chunk->used + size > chunk->size)
+	{
+		if (!chunk->next || chunk->next->size < size)
+			return (arena_grow(arena, size));
+		chunk = chunk->next;
+		chunk->used = 0;
+		arena->current = chunk;
+	}
+	if (!chunk)
+		return (arena_grow(arena, size));
+	return (chunk);
+}
+
+/**
+ * @brief Bump-allocates memory owned by the arena
+ *
+ * @param arena Arena to allocate from
+ * @param size Number of bytes
+ * @return void* Memory aligned on ARENA_ALIGN bytes, or NULL on failure
+ * @note Never free the returned pointer, it lives until arena_reset()
+ */
+void	*arena_alloc(t_arena *arena, size_t size)
+{
+	t_arena_chunk	*chunk;
+	void			*ptr;
+
+	size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+	if (size == 0)
+		size = ARENA_ALIGN;
+	chunk = arena_fit(arena, size);
+	if (!chunk)
+		return (NULL);
+	ptr = chunk->data + chunk->used;
+	chunk->used += size;
+	arena->allocs++;
+	return (ptr);
+}
+
+/**
+ * @brief Releases everything allocated in the arena at once
+ *
+ * Chunks are kept for the next line and lazily rewound when reached again,
+ * which makes the reset O(1).
+ *
+ * @param arena Arena to reset
+ */
+void	arena_reset(t_arena *arena)
+{
+	arena->current = arena->head;
+	if (arena->head)
+		arena->head->used = 0;
+	arena->allocs = 0;
+	arena->mallocs = 0;
+}
+
+/**
+ * @brief Frees all the chunks of the arena
+ *
+ * @param arena Arena to destroy
+ */
+void	arena_destroy(t_arena *arena)
+{
+	t_arena_chunk	*chunk;
+	t_arena_chunk	*next;
+
+	chunk = arena->head;
+	while (chunk)
+	{
+		next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	arena->head = NULL;
+	arena->current = NULL;
+}
@@ -0,0 +1,81 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   arena_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 09:33:01 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:17:00 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "memory.h"
+
+/**
+ * @brief Initializes an empty arena, no memory is allocated until first use
+ *
+ * @param arena Arena to initialize
+ */
+void	arena_init(t_arena *arena)
+{
+	arena->head = NULL;
+	arena->current = NULL;
+	arena->allocs = 0;
+	arena->mallocs = 0;
+}
+
+/**
+ * @brief Copies `len` bytes of a string into the arena
+ *
+ * @param arena Arena to allocate from
+ * @param str String to copy
+ * @param len Number of bytes to copy
+ * @return char* NUL-terminated copy or NULL on failure
+ */
+char	*arena_strndup(t_arena *arena, const char *str, size_t len)
+{
+	char	*dup;
+
+	dup = arena_alloc(arena, len + 1);
+	if (!dup)
+		return (NULL);
+	ft_memcpy(dup, str, len);
+	dup[len] = '\0';
+	return (dup);
+}
+
+/**
+ * @brief Copies a string into the arena
+ *
+ * @param arena Arena to allocate from
+ * @param str String to copy
+ * @return char* Copy or NULL on failure
+ */
+char	*arena_strdup(t_arena *arena, const char *str)
+{
+	if (!str)
+		return (NULL);
+	return (arena_strndup(arena, str, ft_strlen(str)));
+}
+
+/**
+ * @brief Prints the counters of the current line on stderr and resets them
+ *
+ * Besides the arena counters, reports how many words were expanded while
+ * parsing, which should match the number of words and redirection targets
+ * of the pipelines that ran.
+ *
+ * Only active when the MINISHELL_STATS environment variable was set at
+ * startup.
+ *
+ * @param ctx Shell context
+ */
+void	arena_print_stats(t_ctx *ctx)
+{
+	if (ctx->show_stats)
+		ft_printf_fd(STDERR_FILENO, "minishell: stats: %u arena allocs, "
+			"%u mallocs, %u expansions\n", (unsigned int)ctx->arena.allocs,
+			(unsigned int)ctx->arena.mallocs, (unsigned int)ctx->expansions);
+	ctx->expansions = 0;
+}
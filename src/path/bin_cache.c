@@ -0,0 +1,152 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bin_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:55:28 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 15:59:24 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "env.h"
+#include "path.h"
+
+/**
+ * @brief Finds the slot holding a command, or the empty slot ending its run
+ *
+ * @param cache Command cache, with at least one empty slot
+ * @param name Command name
+ * @param hash Hash of the name
+ * @return size_t Slot index
+ */
+static size_t	bin_cache_probe(t_bin_cache *cache, const char *name,
+		unsigned int hash)
+{
+	size_t	i;
+
+	i = hash & (cache->cap - 1);
+	while (cache->slots[i])
+	{
+		if (cache->slots[i]->hash == hash
+			&& ft_strncmp(cache->slots[i]->name, name, __INT_MAX__) == 0)
+			return (i);
+		i = (i + 1) & (cache->cap - 1);
+	}
+	return (i);
+}
+
+/**
+ * @brief Doubles the table and re-indexes every entry
+ *
+ * @param cache Command cache
+ * @return bool false on allocation failure
+ */
+static bool	bin_cache_grow(t_bin_cache *cache)
+{
+	t_bin_entry	**old;
+	t_bin_entry	**slots;
+	size_t		old_cap;
+	size_t		i;
+
+	old_cap = cache->cap;
+	i = BIN_CACHE_MIN;
+	if (old_cap)
+		i = old_cap * 2;
+	slots = ft_calloc(i, sizeof(t_bin_entry *));
+	if (!slots)
+		return (false);
+	old = cache->slots;
+	cache->slots = slots;
+	cache->cap = i;
+	i = 0;
+	while (i < old_cap)
+	{
+		if (old[i])
+			cache->slots[bin_cache_probe(cache, old[i]->name,
+					old[i]->hash)] = old[i];
+		i++;
+	}
+	free(old);
+	return (true);
+}
+
+/**
+ * @brief Looks up a command in the cache
+ *
+ * @param cache Command cache
+ * @param name Command name
+ * @return t_bin_entry* Entry or NULL if the command is not hashed
+ */
+t_bin_entry	*bin_cache_get(t_bin_cache *cache, const char *name)
+{
+	if (!cache->count)
+		return (NULL);
+	return (cache->slots[bin_cache_probe(cache, name,
+				env_hash(name, ft_strlen(name)))]);
+}
+
+/**
+ * @brief Creates the entry of a command that is not hashed yet
+ *
+ * @param cache Command cache
+ * @param name Command name
+ * @param path Full path to copy, or NULL for a miss
+ * @return t_bin_entry* New entry or NULL on allocation failure
+ */
+static t_bin_entry	*bin_cache_add(t_bin_cache *cache, const char *name,
+		const char *path)
+{
+	t_bin_entry	*entry;
+
+	if ((cache->count + 1) * 2 > cache->cap && !bin_cache_grow(cache))
+		return (NULL);
+	entry = ft_calloc(1, sizeof(t_bin_entry));
+	if (!entry)
+		return (NULL);
+	entry->name = ft_strdup(name);
+	if (path)
+		entry->path = ft_strdup(path);
+	if (!entry->name || (path && !entry->path))
+	{
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return (NULL);
+	}
+	entry->hash = env_hash(name, ft_strlen(name));
+	cache->slots[bin_cache_probe(cache, name, entry->hash)] = entry;
+	cache->count++;
+	return (entry);
+}
+
+/**
+ * @brief Remembers the full path of a command, replacing any previous one
+ *
+ * @param cache Command cache
+ * @param name Command name
+ * @param path Full path to copy, NULL to remember a miss
+ * @return t_bin_entry* Entry, with its hit count reset, or NULL on error
+ */
+t_bin_entry	*bin_cache_put(t_bin_cache *cache, const char *name,
+		const char *path)
+{
+	t_bin_entry	*entry;
+	char		*path_copy;
+
+	entry = bin_cache_get(cache, name);
+	if (!entry)
+		return (bin_cache_add(cache, name, path));
+	path_copy = NULL;
+	if (path)
+		path_copy = ft_strdup(path);
+	if (path && !path_copy)
+		return (NULL);
+	free(entry->path);
+	entry->path = path_copy;
+	entry->hits = 0;
+	entry->epoch = 0;
+	return (entry);
+}
@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bin_cache_epoch.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:28:41 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:18:37 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "path.h"
+
+/**
+ * @brief Reads the modification time of a PATH directory
+ *
+ * A directory that cannot be opened counts as having a zero time, so that
+ * it changes when it appears; it is watched from then on, if watching is
+ * on. A watched directory reports its changes instead (see path_watch.c).
+ *
+ * @param ctx Shell context
+ * @param dir PATH directory
+ * @return bool true if the time differs from the one last recorded
+ */
+static bool	path_dir_changed(t_ctx *ctx, t_path_dir *dir)
+{
+	struct stat		dir_stat;
+	struct timespec	mtime;
+	bool			changed;
+
+	if (dir->wd != -1)
+		return (false);
+	mtime = (struct timespec){0, 0};
+	if (path_dir_fd(dir) != -1)
+	{
+		path_watch_add(&ctx->path_vec, dir);
+		if (fstat(dir->fd, &dir_stat) == 0)
+			mtime = dir_stat.st_mtim;
+	}
+	changed = (mtime.tv_sec != dir->mtime.tv_sec
+			|| mtime.tv_nsec != dir->mtime.tv_nsec);
+	dir->mtime = mtime;
+	return (changed);
+}
+
+/**
+ * @brief Returns the epoch of the PATH directories, after checking them
+ *
+ * The epoch moves on whenever a directory was modified (an entry added,
+ * removed or renamed) since the previous check, which costs one fstat()
+ * per directory that is not watched.
+ *
+ * @param ctx Shell context
+ * @return unsigned long Current epoch
+ */
+unsigned long	path_vec_epoch(t_ctx *ctx)
+{
+	t_path_vec	*vec;
+	bool		changed;
+	size_t		i;
+
+	vec = path_vec_get(ctx);
+	if (!vec)
+		return (0);
+	changed = false;
+	i = 0;
+	while (i < vec->count)
+	{
+		if (path_dir_changed(ctx, &vec->dirs[i]))
+			changed = true;
+		i++;
+	}
+	if (changed)
+		vec->epoch++;
+	return (vec->epoch);
+}
+
+/**
+ * @brief Remembers that a command is not in PATH
+ *
+ * Not done when a file of that name exists without being executable:
+ * a chmod would make it a command without modifying its directory.
+ *
+ * @param ctx Shell context
+ * @param name Command name, just searched for in vain
+ * @param epoch Epoch of the PATH directories taken before the search
+ */
+void	bin_cache_miss(t_ctx *ctx, const char *name, unsigned long epoch)
+{
+	t_bin_entry		*entry;
+
+	if (!ctx->path_vec.valid || ctx->path_vec.saw_file)
+		return ;
+	entry = bin_cache_put(&ctx->bin_cache, name, NULL);
+	if (entry)
+		entry->epoch = epoch;
+}
+
+/**
+ * @brief Stamps a command just found in PATH, if its directory is watched
+ *
+ * The stamp spares the check of the path until the watcher reports a
+ * change of that name, or the directories are invalidated altogether.
+ *
+ * @param ctx Shell context
+ * @param entry Entry of the command, found in ctx->path_vec.hit
+ */
+void	bin_cache_hit(t_ctx *ctx, t_bin_entry *entry)
+{
+	entry->epoch = 0;
+	if (ctx->path_vec.valid && ctx->path_vec.dirs[ctx->path_vec.hit].wd != -1)
+		entry->epoch = ctx->path_vec.epoch;
+}
+
+/**
+ * @brief Checks if a cache entry still holds
+ *
+ * A miss holds while no PATH directory changed since. A path holds while
+ * its stamp is current, or else if it is still an executable file.
+ *
+ * @param ctx Shell context
+ * @param entry Cache entry
+ * @return bool true if the entry can be used without searching PATH
+ */
+bool	bin_cache_valid(t_ctx *ctx, t_bin_entry *entry)
+{
+	struct stat	path_stat;
+
+	if (!entry->path)
+		return (path_vec_epoch(ctx) == entry->epoch);
+	if (entry->epoch != 0 && entry->epoch == ctx->path_vec.epoch)
+		return (true);
+	return (stat(entry->path, &path_stat) == 0 && S_ISREG(path_stat.st_mode)
+		&& creds_can_exec(&ctx->creds, &path_stat));
+}
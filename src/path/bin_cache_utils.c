@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bin_cache_utils.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:57:05 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:10:32 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "builtins.h"
+#include "env.h"
+#include "execute.h"
+#include "path.h"
+#include "trace.h"
+
+/**
+ * @brief Initializes an empty command cache
+ *
+ * @param cache Cache to initialize
+ */
+void	bin_cache_init(t_bin_cache *cache)
+{
+	cache->slots = NULL;
+	cache->cap = 0;
+	cache->count = 0;
+}
+
+/**
+ * @brief Forgets every hashed command (`hash -r`)
+ *
+ * @param cache Command cache
+ */
+void	bin_cache_clear(t_bin_cache *cache)
+{
+	size_t	i;
+
+	i = 0;
+	while (i < cache->cap)
+	{
+		if (cache->slots[i])
+		{
+			free(cache->slots[i]->name);
+			free(cache->slots[i]->path);
+			free(cache->slots[i]);
+		}
+		i++;
+	}
+	free(cache->slots);
+	bin_cache_init(cache);
+}
+
+/**
+ * @brief Resolves a command through the cache, searching PATH on a miss
+ *
+ * A hashed path that is no longer executable is searched for again, like
+ * bash does. A command that was not found is not searched for again until
+ * a PATH directory changes (see bin_cache_epoch.c). A miss is stamped with
+ * the epoch as last checked, read before the search: a change made since,
+ * during the search included, makes it stale without any more syscall.
+ *
+ * @param ctx Shell context
+ * @param name Command name, without any slash
+ * @return t_bin_entry* Entry of the command or NULL if it is not in PATH
+ */
+t_bin_entry	*bin_cache_resolve(t_ctx *ctx, char *name)
+{
+	t_bin_entry		*entry;
+	char			*path;
+	unsigned long	epoch;
+
+	entry = bin_cache_get(&ctx->bin_cache, name);
+	if (entry && bin_cache_valid(ctx, entry))
+	{
+		if (!entry->path)
+			return (NULL);
+		return (entry);
+	}
+	epoch = ctx->path_vec.epoch;
+	path = env_find_bin(ctx, name);
+	if (!path)
+		return (bin_cache_miss(ctx, name, epoch), NULL);
+	entry = bin_cache_put(&ctx->bin_cache, name, path);
+	free(path);
+	if (entry)
+		bin_cache_hit(ctx, entry);
+	return (entry);
+}
+
+/**
+ * @brief Resolves an external command in the parent before it is forked
+ *
+ * The child then finds the path in its copy of the cache, and the entry
+ * survives in the parent for the next run.
+ *
+ * @param ctx Shell context
+ * @param cmd Command about to be forked
+ */
+void	bin_cache_prepare(t_ctx *ctx, t_command *cmd)
+{
+	t_bin_entry	*entry;
+
+	if (!cmd->args || !cmd->args[0] || builtin_lookup(cmd->args[0])
+		|| is_path(cmd->args[0]))
+		return ;
+	trace_begin(ctx, "bin_find");
+	entry = bin_cache_resolve(ctx, cmd->args[0]);
+	trace_end(ctx, "bin_find");
+	if (entry)
+		entry->hits++;
+}
+
+/**
+ * @brief Empties the cache and the parsed PATH when PATH is assigned or
+ * unset
+ *
+ * The watcher is replaced by a fresh instance, which drops the watches of
+ * the old directories along with any of their pending events.
+ *
+ * @param ctx Shell context
+ * @param key Name of the variable that changed
+ */
+void	bin_cache_env_changed(t_ctx *ctx, const char *key)
+{
+	if (ft_strncmp(key, "PATH", 5) != 0)
+		return ;
+	bin_cache_clear(&ctx->bin_cache);
+	path_vec_clear(&ctx->path_vec);
+	if (ctx->path_vec.watch_fd == -1)
+		return ;
+	path_watch_close(&ctx->path_vec);
+	path_watch_open(&ctx->path_vec);
+}
@@ -6,7 +6,7 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/28 14:56:48 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:08:49 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:20:14 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -44,31 +44,28 @@ bool	is_path(const char *str)
 /**
  * @brief Validates and resolves an absolute or relative path
  *
- * Checks if the path exists, has proper permissions, and is not a directory.
- * Returns appropriate error status if validation fails.
+ * Checks if the path exists, has proper permissions, and is not a directory,
+ * all from a single stat(). Returns appropriate error status if validation
+ * fails.
  *
+ * @param ctx Shell context
  * @param bin Path to validate
  * @param error_state Pointer to store error state
  * @return Duplicated path if valid, NULL otherwise
  */
-static char	*validate_path(char *bin, t_path_error *error_state)
+static char	*validate_path(t_ctx *ctx, char *bin, t_path_error *error_state)
 {
-	if (is_directory(bin))
-	{
-		*error_state = PATH_ERR_IS_DIR;
-		return (NULL);
-	}
-	if (access(bin, F_OK) != 0)
-	{
+	struct stat	path_stat;
+
+	if (stat(bin, &path_stat) != 0)
 		*error_state = PATH_ERR_NOT_FOUND;
-		return (NULL);
-	}
-	if (access(bin, X_OK) != 0)
-	{
+	else if (S_ISDIR(path_stat.st_mode))
+		*error_state = PATH_ERR_IS_DIR;
+	else if (!creds_can_exec(&ctx->creds, &path_stat))
 		*error_state = PATH_ERR_NO_PERMISSION;
-		return (NULL);
-	}
-	return (ft_strdup(bin));
+	else
+		return (ft_strdup(bin));
+	return (NULL);
 }
 
 /**
@@ -85,6 +82,27 @@ static t_error_type	map_path_error_to_type(t_path_error error_state)
 	return (ERR_CMD_NOT_FOUND);
 }
 
+/**
+ * @brief Searches PATH for a command, going through the command cache first
+ *
+ * A remembered miss was checked by the parent before forking.
+ *
+ * @param ctx Shell context
+ * @param bin Command name
+ * @return Full path (caller must free) or NULL if not found
+ */
+static char	*find_in_path(t_ctx *ctx, char *bin)
+{
+	t_bin_entry	*entry;
+
+	entry = bin_cache_get(&ctx->bin_cache, bin);
+	if (entry && entry->path)
+		return (ft_strdup(entry->path));
+	if (entry)
+		return (NULL);
+	return (env_find_bin(ctx, bin));
+}
+
 /**
  * @brief Resolves a command path, sets ctx->exit_status on error, returns NULL.
  *
@@ -109,7 +127,7 @@ char	*bin_find(t_ctx *ctx, char *bin)
 	}
 	if (is_path(bin))
 	{
-		path = validate_path(bin, &error_state);
+		path = validate_path(ctx, bin, &error_state);
 		if (!path)
 		{
 			ctx->exit_status = handle_path_error(bin,
@@ -118,7 +136,7 @@ char	*bin_find(t_ctx *ctx, char *bin)
 		}
 		return (path);
 	}
-	path = env_find_bin(ctx, bin);
+	path = find_in_path(ctx, bin);
 	if (!path)
 		return (ctx->exit_status = error(bin, NULL, ERR_CMD_NOT_FOUND), NULL);
 	return (path);
@@ -6,78 +6,95 @@
 /*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2025/01/28 14:59:39 by elagouch          #+#    #+#             */
-/*   Updated: 2025/05/06 15:00:13 by elagouch         ###   ########.fr       */
+/*   Updated: 2026/10/18 17:21:51 by elagouch         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
-#include "minishell.h"
+#define _GNU_SOURCE
+#include "path.h"
 
 /**
- * @brief Checks if a file is executable
+ * @brief Checks if a name in a directory is an executable file
  *
- * Verifies that a file exists, is not a directory, and has execute permissions.
+ * One fstatat() answers both questions, existence and permission. A name
+ * that exists but cannot be executed is noted, so that the miss is not
+ * remembered: making it executable does not touch the directory.
  *
- * @param path Path to the file to check
- * @return true if file is executable, false otherwise
+ * @param ctx Shell context
+ * @param fd Descriptor of the directory
+ * @param bin Binary name, relative to the directory
+ * @return true if the file is a regular file the shell may execute
  */
-static bool	is_executable_file(const char *path)
+static bool	is_executable_at(t_ctx *ctx, int fd, const char *bin)
 {
 	struct stat	path_stat;
 
-	if (access(path, F_OK) != 0)
+	if (fstatat(fd, bin, &path_stat, 0) != 0)
 		return (false);
-	if (stat(path, &path_stat) != 0)
-		return (false);
-	if (S_ISDIR(path_stat.st_mode))
-		return (false);
-	if (access(path, X_OK) != 0)
-		return (false);
-	return (true);
+	if (S_ISREG(path_stat.st_mode)
+		&& creds_can_exec(&ctx->creds, &path_stat))
+		return (true);
+	ctx->path_vec.saw_file = true;
+	return (false);
 }
 
 /**
  * @brief Creates a full path by joining directory and filename
  *
- * Allocates and constructs a path in the format "dir/bin".
+ * Allocates and constructs a path in the format "dir/bin" in one go.
  *
- * @param dir Directory path
+ * @param dir PATH directory
  * @param bin Binary name
  * @return Newly allocated full path or NULL on allocation failure
  */
-static char	*join_path(const char *dir, char *bin)
+static char	*join_path(const t_path_dir *dir, const char *bin)
 {
-	char	*tmp;
 	char	*full_path;
+	size_t	bin_len;
 
-	tmp = ft_strjoin(dir, "/");
-	if (!tmp)
+	bin_len = ft_strlen(bin);
+	full_path = malloc(dir->len + bin_len + 2);
+	if (!full_path)
 		return (NULL);
-	full_path = ft_strjoin(tmp, bin);
-	free(tmp);
+	ft_memcpy(full_path, dir->dir, dir->len);
+	full_path[dir->len] = '/';
+	ft_memcpy(full_path + dir->len + 1, bin, bin_len + 1);
 	return (full_path);
 }
 
+/**
+ * @brief Returns the descriptor of a PATH directory, opening it if needed
+ *
+ * The directory is opened (with O_PATH where available) the first time it
+ * is used, so that the kernel does not walk its path again. A directory
+ * that cannot be opened is tried again the next time, as it may have been
+ * created since.
+ *
+ * @param dir PATH directory
+ * @return int Descriptor, or -1 if the directory cannot be opened
+ */
+int	path_dir_fd(t_path_dir *dir)
+{
+	if (dir->fd == -1)
+		dir->fd = open(dir->dir, PATH_DIR_FLAGS);
+	return (dir->fd);
+}
+
 /**
  * @brief Searches for a binary in a specific directory
  *
- * Checks if the specified binary exists and is executable in the given
- * directory.
+ * Candidates are probed relative to the descriptor of the directory.
  *
- * @param dir Directory to search in
+ * @param ctx Shell context
+ * @param dir PATH directory to search in
  * @param bin Binary name to look for
  * @return Full path if executable binary found, NULL otherwise
  */
-char	*bin_find_path(const char *dir, char *bin)
+char	*bin_find_path(t_ctx *ctx, t_path_dir *dir, const char *bin)
 {
-	char	*full_path;
-
 	if (!dir || !bin)
 		return (NULL);
-	full_path = join_path(dir, bin);
-	if (!full_path)
+	if (path_dir_fd(dir) == -1 || !is_executable_at(ctx, dir->fd, bin))
 		return (NULL);
-	if (is_executable_file(full_path))
-		return (full_path);
-	free(full_path);
-	return (NULL);
+	return (join_path(dir, bin));
 }
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_exec.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:12:31 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:31 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "path.h"
+
+/**
+ * @brief Reads the effective credentials of the shell, once at startup
+ *
+ * If the supplementary groups cannot be read, only the effective group is
+ * considered.
+ *
+ * @param creds Credentials to fill
+ */
+void	creds_init(t_creds *creds)
+{
+	creds->uid = geteuid();
+	creds->gid = getegid();
+	creds->groups = NULL;
+	creds->ngroups = getgroups(0, NULL);
+	if (creds->ngroups > 0)
+		creds->groups = malloc(creds->ngroups * sizeof(gid_t));
+	if (creds->groups)
+		creds->ngroups = getgroups(creds->ngroups, creds->groups);
+	if (!creds->groups || creds->ngroups < 0)
+		creds->ngroups = 0;
+}
+
+/**
+ * @brief Releases the supplementary groups
+ *
+ * @param creds Credentials
+ */
+void	creds_clear(t_creds *creds)
+{
+	free(creds->groups);
+	creds->groups = NULL;
+	creds->ngroups = 0;
+}
+
+/**
+ * @brief Checks if the shell is in the group owning a file
+ *
+ * @param creds Credentials of the shell
+ * @param gid Group owning the file
+ * @return bool true if it is its effective or a supplementary group
+ */
+static bool	creds_in_group(const t_creds *creds, gid_t gid)
+{
+	int	i;
+
+	if (gid == creds->gid)
+		return (true);
+	i = 0;
+	while (i < creds->ngroups)
+	{
+		if (creds->groups[i] == gid)
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Tells from its stat() whether the shell may execute a file
+ *
+ * Applies the permission bits the way execve() does, for the effective
+ * user: root needs any execute bit, the owner the user bit, members of
+ * the group the group bit and anybody else the other bit. ACLs are not
+ * looked at; a file they forbid fails later at execve() with EACCES.
+ *
+ * @param creds Credentials of the shell
+ * @param st Result of stat() on the file
+ * @return bool true if it may be executed
+ */
+bool	creds_can_exec(const t_creds *creds, const struct stat *st)
+{
+	if (creds->uid == 0)
+		return ((st->st_mode & (S_IXUSR | S_IXGRP | S_IXOTH)) != 0);
+	if (st->st_uid == creds->uid)
+		return ((st->st_mode & S_IXUSR) != 0);
+	if (creds_in_group(creds, st->st_gid))
+		return ((st->st_mode & S_IXGRP) != 0);
+	return ((st->st_mode & S_IXOTH) != 0);
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_vec.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:59:35 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 16:04:15 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "env.h"
+#include "path.h"
+
+/**
+ * @brief Counts the directories of a PATH value, empty ones included
+ *
+ * @param path Value of PATH
+ * @return size_t Upper bound of the number of directories
+ */
+static size_t	path_count(const char *path)
+{
+	size_t	count;
+
+	count = 1;
+	while (*path)
+	{
+		if (*path == ':')
+			count++;
+		path++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Appends one directory of PATH to the vector
+ *
+ * The directory is only opened when first searched (see bin_find_path.c),
+ * but watched right away if watching is on (see path_watch.c).
+ *
+ * @param vec PATH vector, with room for the directory
+ * @param dir Start of the directory in the PATH value
+ * @param len Length of the directory
+ * @return bool false on allocation failure
+ */
+static bool	path_vec_push(t_path_vec *vec, const char *dir, size_t len)
+{
+	t_path_dir	*entry;
+
+	entry = &vec->dirs[vec->count];
+	entry->dir = ft_substr(dir, 0, len);
+	if (!entry->dir)
+		return (false);
+	entry->len = len;
+	if (dir[len - 1] == '/')
+		entry->len--;
+	entry->fd = -1;
+	entry->wd = -1;
+	entry->mtime = (struct timespec){0, 0};
+	path_watch_add(vec, entry);
+	vec->count++;
+	return (true);
+}
+
+/**
+ * @brief Splits a PATH value into the vector
+ *
+ * Empty directories are skipped, as they always have been here. The epoch
+ * moves on so that no stamp of a previous PATH matches.
+ *
+ * @param vec Empty PATH vector
+ * @param path Value of PATH
+ * @return bool false on allocation failure
+ */
+static bool	path_vec_build(t_path_vec *vec, const char *path)
+{
+	size_t	len;
+
+	vec->dirs = malloc(path_count(path) * sizeof(t_path_dir));
+	if (!vec->dirs)
+		return (false);
+	while (*path)
+	{
+		len = 0;
+		while (path[len] && path[len] != ':')
+			len++;
+		if (len > 0 && !path_vec_push(vec, path, len))
+			return (false);
+		path += len;
+		if (*path == ':')
+			path++;
+	}
+	vec->valid = true;
+	vec->epoch++;
+	return (true);
+}
+
+/**
+ * @brief Returns the parsed PATH, parsing it if it changed since last time
+ *
+ * @param ctx Shell context
+ * @return t_path_vec* PATH vector, or NULL if PATH is unset or empty
+ */
+t_path_vec	*path_vec_get(t_ctx *ctx)
+{
+	char	*path;
+
+	if (ctx->path_vec.valid)
+		return (&ctx->path_vec);
+	path = get_env_value(&ctx->env, "PATH");
+	if (!path || !*path)
+		return (NULL);
+	if (!path_vec_build(&ctx->path_vec, path))
+	{
+		path_vec_clear(&ctx->path_vec);
+		return (NULL);
+	}
+	return (&ctx->path_vec);
+}
+
+/**
+ * @brief Forgets the parsed PATH and closes its directories
+ *
+ * @param vec PATH vector
+ */
+void	path_vec_clear(t_path_vec *vec)
+{
+	while (vec->count > 0)
+	{
+		vec->count--;
+		if (vec->dirs[vec->count].fd != -1)
+			close(vec->dirs[vec->count].fd);
+		free(vec->dirs[vec->count].dir);
+	}
+	free(vec->dirs);
+	vec->dirs = NULL;
+	vec->valid = false;
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_watch.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:46:28 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 17:23:28 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "path.h"
+
+/**
+ * @brief Starts watching the PATH directories (MINISHELL_WATCH_PATH)
+ *
+ * Directories parsed from then on are watched as they are added to the
+ * vector. Changes are then reported by path_watch_poll() instead of being
+ * checked for on each lookup.
+ *
+ * @param vec PATH vector, with no directory yet
+ */
+void	path_watch_open(t_path_vec *vec)
+{
+	vec->watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+}
+
+/**
+ * @brief Stops watching, in the shell or in a child leaving
+ *
+ * The instance is closed rather than its watches removed: a child shares it
+ * with the shell.
+ *
+ * @param vec PATH vector
+ */
+void	path_watch_close(t_path_vec *vec)
+{
+	if (vec->watch_fd != -1)
+		close(vec->watch_fd);
+	vec->watch_fd = -1;
+}
+
+/**
+ * @brief Watches one PATH directory, if watching is on
+ *
+ * A directory that does not exist stays unwatched (wd -1), and is checked
+ * on each lookup as without the watcher.
+ *
+ * @param vec PATH vector
+ * @param dir Directory of the vector
+ */
+void	path_watch_add(t_path_vec *vec, t_path_dir *dir)
+{
+	if (vec->watch_fd == -1 || dir->wd != -1)
+		return ;
+	dir->wd = inotify_add_watch(vec->watch_fd, dir->dir, PATH_WATCH_MASK);
+}
+
+/**
+ * @brief Applies one change to the cache
+ *
+ * A name added, removed or changed in a directory only invalidates the
+ * entry of that name. A directory that went away, or a lost event,
+ * invalidates every entry, and the directory is then checked as unwatched.
+ *
+ * @param ctx Shell context
+ * @param event Event, its name following it in the buffer
+ * @param name Name the event is about
+ */
+static void	path_watch_event(t_ctx *ctx, struct inotify_event *event,
+		const char *name)
+{
+	t_bin_entry	*entry;
+	t_path_dir	*dir;
+	size_t		i;
+
+	if (event->len > 0)
+	{
+		entry = bin_cache_get(&ctx->bin_cache, name);
+		if (entry)
+			entry->epoch = 0;
+		return ;
+	}
+	ctx->path_vec.epoch++;
+	i = 0;
+	while (i < ctx->path_vec.count && ctx->path_vec.dirs[i].wd != event->wd)
+		i++;
+	if (i == ctx->path_vec.count || event->wd == -1)
+		return ;
+	dir = &ctx->path_vec.dirs[i];
+	if (event->mask & IN_MOVE_SELF)
+		inotify_rm_watch(ctx->path_vec.watch_fd, dir->wd);
+	if (dir->fd != -1)
+		close(dir->fd);
+	dir->fd = -1;
+	dir->wd = -1;
+}
+
+/**
+ * @brief Reads the pending changes of the PATH directories, if watched
+ *
+ * Called before each line; never blocks.
+ *
+ * @param ctx Shell context
+ */
+void	path_watch_poll(t_ctx *ctx)
+{
+	char					buf[PATH_WATCH_BUF];
+	struct inotify_event	event;
+	ssize_t					len;
+	ssize_t					i;
+
+	if (ctx->path_vec.watch_fd == -1)
+		return ;
+	len = read(ctx->path_vec.watch_fd, buf, sizeof(buf));
+	while (len > 0)
+	{
+		i = 0;
+		while (i + (ssize_t) sizeof(event) <= len)
+		{
+			ft_memcpy(&event, buf + i, sizeof(event));
+			path_watch_event(ctx, &event, buf + i + sizeof(event));
+			i += sizeof(event) + event.len;
+		}
+		len = read(ctx->path_vec.watch_fd, buf, sizeof(buf));
+	}
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:29:03 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:29:03 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "trace.h"
+
+/**
+ * @brief Enables tracing if MINISHELL_TRACE names an output file
+ *
+ * The ring is allocated once here, so recording an event never allocates
+ * nor writes: events are only written out between command lines.
+ *
+ * @param ctx Shell context
+ */
+void	trace_init(t_ctx *ctx)
+{
+	char	*path;
+
+	ctx->trace.fd = -1;
+	ctx->trace.head = 0;
+	ctx->trace.count = 0;
+	ctx->trace.dropped = 0;
+	ctx->trace.pid = getpid();
+	ctx->trace.ring = NULL;
+	path = getenv("MINISHELL_TRACE");
+	if (path && *path)
+		ctx->trace.ring = malloc(sizeof(t_trace_event) * TRACE_RING);
+	if (!ctx->trace.ring)
+		return ;
+	ctx->trace.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND
+			| O_CLOEXEC, 0644);
+	if (ctx->trace.fd == -1)
+	{
+		free(ctx->trace.ring);
+		ctx->trace.ring = NULL;
+		return ;
+	}
+	write(ctx->trace.fd, "[\n", 2);
+}
+
+/**
+ * @brief Records an event in the ring, overwriting the oldest when full
+ *
+ * @param ctx Shell context
+ * @param name Event name, must be a string literal
+ * @param phase Chrome trace phase: 'B' begin, 'E' end, 'i' instant
+ */
+void	trace_event(t_ctx *ctx, const char *name, char phase)
+{
+	t_trace_event	*event;
+	struct timespec	now;
+
+	if (ctx->trace.fd < 0)
+		return ;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	event = &ctx->trace.ring[ctx->trace.head];
+	event->name = name;
+	event->phase = phase;
+	event->pid = ctx->trace.pid;
+	event->ts = (unsigned long)now.tv_sec * 1000000UL
+		+ (unsigned long)now.tv_nsec / 1000UL;
+	ctx->trace.head = (ctx->trace.head + 1) % TRACE_RING;
+	if (ctx->trace.count < TRACE_RING)
+		ctx->trace.count++;
+	else
+		ctx->trace.dropped++;
+}
+
+/**
+ * @brief Marks the beginning of a traced phase
+ *
+ * @param ctx Shell context
+ * @param name Phase name, must be a string literal
+ */
+void	trace_begin(t_ctx *ctx, const char *name)
+{
+	trace_event(ctx, name, 'B');
+}
+
+/**
+ * @brief Marks the end of a traced phase
+ *
+ * @param ctx Shell context
+ * @param name Phase name, same as the matching trace_begin()
+ */
+void	trace_end(t_ctx *ctx, const char *name)
+{
+	trace_event(ctx, name, 'E');
+}
+
+/**
+ * @brief fork() recorded as a phase of the parent
+ *
+ * The child drops the events it inherited, which belong to the parent,
+ * and records its own under its pid.
+ *
+ * @param ctx Shell context
+ * @return pid_t Result of fork()
+ */
+pid_t	trace_fork(t_ctx *ctx)
+{
+	pid_t	pid;
+
+	trace_begin(ctx, "fork");
+	pid = fork();
+	if (pid == 0 && ctx->trace.fd >= 0)
+	{
+		ctx->trace.pid = getpid();
+		ctx->trace.count = 0;
+		ctx->trace.dropped = 0;
+	}
+	else
+		trace_end(ctx, "fork");
+	return (pid);
+}
@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   trace_flush.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: elagouch <elagouch@student.42.fr>          +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 13:30:40 by elagouch          #+#    #+#             */
+/*   Updated: 2026/10/18 13:30:40 by elagouch         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "trace.h"
+
+/**
+ * @brief Writes the recorded events out as Chrome trace events
+ *
+ * The file uses the JSON array format, in which the closing bracket is
+ * optional: it is never written, so that forked children can append their
+ * own events to the same file at any time.
+ *
+ * @param ctx Shell context
+ */
+void	trace_flush(t_ctx *ctx)
+{
+	t_outbuf		out;
+	t_trace_event	*event;
+	size_t			i;
+
+	if (ctx->trace.fd < 0 || ctx->trace.count == 0)
+		return ;
+	ft_outbuf_init(&out, ctx->trace.fd);
+	i = (ctx->trace.head + TRACE_RING - ctx->trace.count) % TRACE_RING;
+	if (ctx->trace.dropped)
+		ft_buf_printf(&out, "{\"name\":\"%u events dropped\",\"ph\":\"i\","
+			"\"ts\":%lu,\"pid\":%d,\"tid\":%d},\n",
+			(unsigned int)ctx->trace.dropped, ctx->trace.ring[i].ts,
+			ctx->trace.pid, ctx->trace.pid);
+	while (ctx->trace.count)
+	{
+		event = &ctx->trace.ring[i];
+		ft_buf_printf(&out, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%lu,"
+			"\"pid\":%d,\"tid\":%d},\n", event->name, event->phase,
+			event->ts, event->pid, event->pid);
+		i = (i + 1) % TRACE_RING;
+		ctx->trace.count--;
+	}
+	ctx->trace.dropped = 0;
+	ft_outbuf_flush(&out);
+}
+
+/**
+ * @brief Records the execve() of a forked child and writes its events
+ *
+ * Must be called right before execve(), which discards the ring.
+ *
+ * @param ctx Shell context
+ */
+void	trace_exec(t_ctx *ctx)
+{
+	trace_event(ctx, "execve", 'i');
+	trace_flush(ctx);
+}
+
+/**
+ * @brief Writes the remaining events and releases the trace resources
+ *
+ * @param ctx Shell context
+ */
+void	trace_close(t_ctx *ctx)
+{
+	if (ctx->trace.fd < 0)
+		return ;
+	trace_flush(ctx);
+	close(ctx->trace.fd);
+	ctx->trace.fd = -1;
+	free(ctx->trace.ring);
+	ctx->trace.ring = NULL;
+}